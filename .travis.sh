@@ -22,3 +22,18 @@ do
 	cp $file src/main.cpp
 	make all GNUCC=arm-none-eabi- -f makefile.gnucc
 done
+
+# configurations combining options that share kernel code
+for config in "OS_TMR_HEAP=1 OS_HEAP_SIZE=8192"
+do
+	rm -f src/main.*
+	echo $config
+	cp src/osconfig.h src/osconfig.h.bak
+	for option in $config
+	do
+		sed -i "s/^#define  ${option%%=*} .*/#define  ${option%%=*} ${option#*=}/" src/osconfig.h
+	done
+	cp examples/$(ls examples | grep '\.c_$' | head -n 1) src/main.c
+	make all GNUCC=arm-none-eabi- -f makefile.gnucc
+	mv -f src/osconfig.h.bak src/osconfig.h
+done
@@ -133,12 +133,22 @@ int32_t osKernelRestoreLock (int32_t lock)
 
 uint32_t osKernelSuspend (void)
 {
+#if OS_TICKLESS == 0
+	uint32_t ticks = core_sys_suspend();
+
+	return ticks == INFINITE ? osWaitForever : ticks;
+#else
 	return 0U;
+#endif
 }
 
 void osKernelResume (uint32_t sleep_ticks)
 {
+#if OS_TICKLESS == 0
+	core_sys_resume(sleep_ticks);
+#else
 	(void) sleep_ticks;
+#endif
 }
 
 uint32_t osKernelGetTickCount (void)
@@ -334,6 +344,36 @@ uint32_t osThreadGetStackSpace (osThreadId_t thread_id)
 	return (uint32_t) port_get_sp() - (uint32_t) thread->tsk.stack;
 }
 
+#if OS_TSK_STATS
+
+uint64_t osThreadGetRunTime (osThreadId_t thread_id)
+{
+	osThread_t *thread = thread_id;
+	uint64_t runtime;
+
+	if (thread_id == NULL)
+		return 0U;
+
+	tsk_getStats(&thread->tsk, &runtime, NULL);
+
+	return runtime;
+}
+
+uint32_t osThreadGetSwitchCount (osThreadId_t thread_id)
+{
+	osThread_t *thread = thread_id;
+	unsigned switches;
+
+	if (thread_id == NULL)
+		return 0U;
+
+	tsk_getStats(&thread->tsk, NULL, &switches);
+
+	return switches;
+}
+
+#endif
+
 osStatus_t osThreadSetPriority (osThreadId_t thread_id, osPriority_t priority)
 {
 	osThread_t *thread = thread_id;
@@ -581,7 +621,7 @@ osStatus_t osDelayUntil (uint32_t ticks)
 
 static void timer_handler (void)
 {
-	osTimer_t *cur = (osTimer_t *)WAIT.obj.next;
+	osTimer_t *cur = (osTimer_t *)ThisTmr;
 
 	cur->func(cur->arg);
 }
@@ -830,7 +870,7 @@ osMutexId_t osMutexNew (const osMutexAttr_t *attr)
 
 	sys_lock();
 
-	mtx_init(&mutex->mtx);
+	mtx_initCeiling(&mutex->mtx, (flags & osMutexPrioCeilingMask) >> 24);
 	if (attr->cb_mem == NULL || attr->cb_size == 0U) mutex->mtx.res = mutex;
 	mutex->flags = flags;
 	mutex->name = (attr == NULL) ? NULL : attr->name;
@@ -1138,37 +1178,21 @@ uint32_t osMemoryPoolGetBlockSize (osMemoryPoolId_t mp_id)
 uint32_t osMemoryPoolGetCount (osMemoryPoolId_t mp_id)
 {
 	osMemoryPool_t *mp = mp_id;
-	uint32_t     count = mp->mem.limit;
-	que_t         *que;
 
 	if (mp_id == NULL)
 		return 0U;
 
-	sys_lock();
-
-	for (que = mp->mem.next; que != NULL; que = que->next) count--;
-
-	sys_unlock();
-
-	return count;
+	return mp->mem.limit - mp->mem.count;
 }
 
 uint32_t osMemoryPoolGetSpace (osMemoryPoolId_t mp_id)
 {
 	osMemoryPool_t *mp = mp_id;
-	uint32_t     count = 0;
-	que_t        *que;
 
 	if (mp_id == NULL)
 		return 0U;
 
-	sys_lock();
-
-	for (que = mp->mem.next; que != NULL; que = que->next) count++;
-
-	sys_unlock();
-
-	return count;
+	return mp->mem.count;
 }
 
 osStatus_t osMemoryPoolDelete (osMemoryPoolId_t mp_id)
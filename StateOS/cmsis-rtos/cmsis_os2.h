@@ -388,6 +388,16 @@ uint32_t osThreadGetStackSize (osThreadId_t thread_id);
 /// \return remaining stack space in bytes.
 uint32_t osThreadGetStackSpace (osThreadId_t thread_id);
  
+/// Get execution time of a thread (StateOS extension, available if OS_TSK_STATS > 0).
+/// \param[in]     thread_id     thread ID obtained by \ref osThreadNew or \ref osThreadGetId.
+/// \return execution time in cpu cycles (in system timer ticks if cpu cycle counter is not available).
+uint64_t osThreadGetRunTime (osThreadId_t thread_id);
+ 
+/// Get number of context switches to a thread (StateOS extension, available if OS_TSK_STATS > 0).
+/// \param[in]     thread_id     thread ID obtained by \ref osThreadNew or \ref osThreadGetId.
+/// \return number of context switches.
+uint32_t osThreadGetSwitchCount (osThreadId_t thread_id);
+ 
 /// Change priority of a thread.
 /// \param[in]     thread_id     thread ID obtained by \ref osThreadNew or \ref osThreadGetId.
 /// \param[in]     priority      new priority value for the thread function.
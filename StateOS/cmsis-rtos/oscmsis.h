@@ -105,6 +105,11 @@ typedef struct __Mutex osMutex_t;
 
 #define osMutexCbSize sizeof(osMutex_t)
 
+/// StateOS extension of mutex attributes (attr_bits in \ref osMutexAttr_t):
+/// priority ceiling protocol with the priority ceiling 'priority' (instead of priority inheritance protocol)
+#define osMutexPrioCeiling(priority) ((uint32_t)(priority) << 24)
+#define osMutexPrioCeilingMask        0xFF000000U
+
 /*---------------------------------------------------------------------------*/
 
 struct __Semaphore
@@ -217,6 +217,28 @@ void bar_kill( bar_t *bar );
 
 void bar_delete( bar_t *bar );
 
+#if OS_BAR_CACHE
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : bar_cacheStat                                                                                  *
+ *                                                                                                                    *
+ * Description       : get hit / miss counters of the cache of barrier objects                                        *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   hit             : pointer to store the number of objects allocated from the cache (can be null)                  *
+ *   miss            : pointer to store the number of objects allocated from the system heap (can be null)            *
+ *                                                                                                                    *
+ * Return            : none                                                                                           *
+ *                                                                                                                    *
+ * Note              : available if OS_BAR_CACHE > 0                                                                  *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+void bar_cacheStat( unsigned *hit, unsigned *miss );
+
+#endif
+
 /**********************************************************************************************************************
  *                                                                                                                    *
  * Name              : bar_waitUntil                                                                                  *
@@ -238,6 +260,32 @@ void bar_delete( bar_t *bar );
 
 unsigned bar_waitUntil( bar_t *bar, uint32_t time );
 
+#if OS_TIME64
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : bar_waitUntil64                                                                                *
+ *                                                                                                                    *
+ * Description       : wait for release the barrier object until given timepoint                                      *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   bar             : pointer to barrier object                                                                      *
+ *   time            : 64-bit timepoint value (sys_time64)                                                            *
+ *                                                                                                                    *
+ * Return                                                                                                             *
+ *   E_SUCCESS       : barrier object was successfully released                                                       *
+ *   E_STOPPED       : barrier object was killed before the specified timeout expired                                 *
+ *   E_TIMEOUT       : barrier object was not released before the specified timeout expired                           *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                     available if OS_TIME64 > 0                                                                     *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+unsigned bar_waitUntil64( bar_t *bar, uint64_t time );
+
+#endif
+
 /**********************************************************************************************************************
  *                                                                                                                    *
  * Name              : bar_waitFor                                                                                    *
@@ -308,6 +356,9 @@ struct Barrier : public __bar
 
 	void     kill     ( void )            {        bar_kill     (this);         }
 	unsigned waitUntil( uint32_t _time  ) { return bar_waitUntil(this, _time);  }
+#if OS_TIME64
+	unsigned waitUntil64( uint64_t _time  ) { return bar_waitUntil64(this, _time);  }
+#endif
 	unsigned waitFor  ( uint32_t _delay ) { return bar_waitFor  (this, _delay); }
 	unsigned wait     ( void )            { return bar_wait     (this);         }
 };
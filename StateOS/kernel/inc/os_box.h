@@ -54,6 +54,7 @@ struct __box
 	unsigned next;  // next element to write into queue
 	char   * data;  // queue data
 	unsigned size;  // size of a single mail (in bytes)
+	void  (* copy)( void *, const void * ); // procedure copying a single mail (optional, used by c++ templates)
 };
 
 /**********************************************************************************************************************
@@ -73,7 +74,7 @@ struct __box
  *                                                                                                                    *
  **********************************************************************************************************************/
 
-#define               _BOX_INIT( _limit, _size, _data ) { 0, 0, 0, _limit, 0, 0, _data, _size }
+#define               _BOX_INIT( _limit, _size, _data ) { 0, 0, 0, _limit, 0, 0, _data, _size, 0 }
 
 /**********************************************************************************************************************
  *                                                                                                                    *
@@ -92,7 +93,7 @@ struct __box
  **********************************************************************************************************************/
 
 #ifndef __cplusplus
-#define               _BOX_DATA( _limit, _size ) (char[_limit * _size]){ 0 }
+#define               _BOX_DATA( _limit, _size ) (char *)(stk_t[ASIZE(_limit * _size)]){ 0 }
 #endif
 
 /**********************************************************************************************************************
@@ -109,8 +110,8 @@ struct __box
  **********************************************************************************************************************/
 
 #define             OS_BOX( box, limit, size )                                \
-                       char box##__buf[limit*size];                            \
-                       box_t box##__box = _BOX_INIT( limit, size, box##__buf ); \
+                       stk_t box##__buf[ASIZE(limit*size)];                             \
+                       box_t box##__box = _BOX_INIT( limit, size, (char *)box##__buf ); \
                        box_id box = & box##__box
 
 /**********************************************************************************************************************
@@ -127,8 +128,8 @@ struct __box
  **********************************************************************************************************************/
 
 #define         static_BOX( box, limit, size )                                \
-                static char box##__buf[limit*size];                            \
-                static box_t box##__box = _BOX_INIT( limit, size, box##__buf ); \
+                static stk_t box##__buf[ASIZE(limit*size)];                             \
+                static box_t box##__box = _BOX_INIT( limit, size, (char *)box##__buf ); \
                 static box_id box = & box##__box
 
 /**********************************************************************************************************************
@@ -275,6 +276,34 @@ void box_delete( box_t *box );
 
 unsigned box_waitUntil( box_t *box, void *data, uint32_t time );
 
+#if OS_TIME64
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : box_waitUntil64                                                                                *
+ *                                                                                                                    *
+ * Description       : try to transfer mailbox data from the mailbox queue object,                                    *
+ *                     wait until given timepoint while the mailbox queue object is empty                             *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   box             : pointer to mailbox queue object                                                                *
+ *   data            : pointer to store mailbox data                                                                  *
+ *   time            : 64-bit timepoint value (sys_time64)                                                            *
+ *                                                                                                                    *
+ * Return                                                                                                             *
+ *   E_SUCCESS       : mailbox data was successfully transfered from the mailbox queue object                         *
+ *   E_STOPPED       : mailbox queue object was killed before the specified timeout expired                           *
+ *   E_TIMEOUT       : mailbox queue object is empty and was not received data before the specified timeout expired   *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                     available if OS_TIME64 > 0                                                                     *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+unsigned box_waitUntil64( box_t *box, void *data, uint64_t time );
+
+#endif
+
 /**********************************************************************************************************************
  *                                                                                                                    *
  * Name              : box_waitFor                                                                                    *
@@ -480,6 +509,260 @@ unsigned box_give( box_t *box, const void *data ) { return box_sendFor(box, data
 __STATIC_INLINE
 unsigned box_giveISR( box_t *box, const void *data ) { return box_sendFor(box, data, IMMEDIATE); }
 
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : box_sendMany                                                                                   *
+ *                                                                                                                    *
+ * Description       : try to transfer an array of mailbox data to the mailbox queue object,                          *
+ *                     don't wait if the mailbox queue object is full, wake each resumed task only once               *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   box             : pointer to mailbox queue object                                                                *
+ *   data            : pointer to array of mailbox data                                                               *
+ *   count           : number of elements in the array                                                                *
+ *                                                                                                                    *
+ * Return            : number of mailbox data transfered to the mailbox queue object                                  *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+unsigned box_sendMany( box_t *box, const void *data, unsigned count );
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : box_sendManyISR                                                                                *
+ *                                                                                                                    *
+ * Description       : try to transfer an array of mailbox data to the mailbox queue object,                          *
+ *                     don't wait if the mailbox queue object is full, wake each resumed task only once               *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   box             : pointer to mailbox queue object                                                                *
+ *   data            : pointer to array of mailbox data                                                               *
+ *   count           : number of elements in the array                                                                *
+ *                                                                                                                    *
+ * Return            : number of mailbox data transfered to the mailbox queue object                                  *
+ *                                                                                                                    *
+ * Note              : use only in handler mode                                                                       *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+__STATIC_INLINE
+unsigned box_sendManyISR( box_t *box, const void *data, unsigned count ) { return box_sendMany(box, data, count); }
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : box_waitMany                                                                                   *
+ *                                                                                                                    *
+ * Description       : try to transfer an array of mailbox data from the mailbox queue object,                        *
+ *                     don't wait if the mailbox queue object is empty, wake each resumed task only once              *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   box             : pointer to mailbox queue object                                                                *
+ *   data            : pointer to array to store mailbox data                                                         *
+ *   count           : number of elements in the array                                                                *
+ *                                                                                                                    *
+ * Return            : number of mailbox data transfered from the mailbox queue object                                *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+unsigned box_waitMany( box_t *box, void *data, unsigned count );
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : box_waitManyISR                                                                                *
+ *                                                                                                                    *
+ * Description       : try to transfer an array of mailbox data from the mailbox queue object,                        *
+ *                     don't wait if the mailbox queue object is empty, wake each resumed task only once              *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   box             : pointer to mailbox queue object                                                                *
+ *   data            : pointer to array to store mailbox data                                                         *
+ *   count           : number of elements in the array                                                                *
+ *                                                                                                                    *
+ * Return            : number of mailbox data transfered from the mailbox queue object                                *
+ *                                                                                                                    *
+ * Note              : use only in handler mode                                                                       *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+__STATIC_INLINE
+unsigned box_waitManyISR( box_t *box, void *data, unsigned count ) { return box_waitMany(box, data, count); }
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : box_reserveUntil                                                                               *
+ *                                                                                                                    *
+ * Description       : try to reserve a free mail slot in the mailbox queue object,                                   *
+ *                     wait until given timepoint while the mailbox queue object is full                              *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   box             : pointer to mailbox queue object                                                                *
+ *   data            : pointer to store the pointer to the reserved mail slot                                         *
+ *   time            : timepoint value                                                                                *
+ *                                                                                                                    *
+ * Return                                                                                                             *
+ *   E_SUCCESS       : mail slot was successfully reserved                                                            *
+ *   E_STOPPED       : mailbox queue object was killed before the specified timeout expired                           *
+ *   E_TIMEOUT       : mailbox queue object is full and no slot was released before the specified timeout expired     *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+unsigned box_reserveUntil( box_t *box, void **data, uint32_t time );
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : box_reserveFor                                                                                 *
+ *                                                                                                                    *
+ * Description       : try to reserve a free mail slot in the mailbox queue object,                                   *
+ *                     wait for given duration of time while the mailbox queue object is full                         *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   box             : pointer to mailbox queue object                                                                *
+ *   data            : pointer to store the pointer to the reserved mail slot                                         *
+ *   delay           : duration of time (maximum number of ticks to wait while the mailbox queue object is full)      *
+ *                     IMMEDIATE: don't wait if the mailbox queue object is full                                      *
+ *                     INFINITE:  wait indefinitly while the mailbox queue object is full                             *
+ *                                                                                                                    *
+ * Return                                                                                                             *
+ *   E_SUCCESS       : mail slot was successfully reserved                                                            *
+ *   E_STOPPED       : mailbox queue object was killed before the specified timeout expired                           *
+ *   E_TIMEOUT       : mailbox queue object is full and no slot was released before the specified timeout expired     *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+unsigned box_reserveFor( box_t *box, void **data, uint32_t delay );
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : box_reserve                                                                                    *
+ *                                                                                                                    *
+ * Description       : try to reserve a free mail slot in the mailbox queue object,                                   *
+ *                     wait indefinitly while the mailbox queue object is full                                        *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   box             : pointer to mailbox queue object                                                                *
+ *   data            : pointer to store the pointer to the reserved mail slot                                         *
+ *                                                                                                                    *
+ * Return                                                                                                             *
+ *   E_SUCCESS       : mail slot was successfully reserved                                                            *
+ *   E_STOPPED       : mailbox queue object was killed before the specified timeout expired                           *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+__STATIC_INLINE
+unsigned box_reserve( box_t *box, void **data ) { return box_reserveFor(box, data, INFINITE); }
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : box_commit                                                                                     *
+ *                                                                                                                    *
+ * Description       : append the mail slot previously reserved with box_reserve to the mailbox queue object,         *
+ *                     resume the first task waiting for a mail                                                       *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   box             : pointer to mailbox queue object                                                                *
+ *                                                                                                                    *
+ * Return            : none                                                                                           *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+void box_commit( box_t *box );
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : box_peekUntil                                                                                  *
+ *                                                                                                                    *
+ * Description       : try to get access to the oldest mail in the mailbox queue object without copying,              *
+ *                     wait until given timepoint while the mailbox queue object is empty                             *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   box             : pointer to mailbox queue object                                                                *
+ *   data            : pointer to store the pointer to the oldest mail                                                *
+ *   time            : timepoint value                                                                                *
+ *                                                                                                                    *
+ * Return                                                                                                             *
+ *   E_SUCCESS       : pointer to the oldest mail was successfully stored                                             *
+ *   E_STOPPED       : mailbox queue object was killed before the specified timeout expired                           *
+ *   E_TIMEOUT       : mailbox queue object is empty and was not received data before the specified timeout expired   *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+unsigned box_peekUntil( box_t *box, void **data, uint32_t time );
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : box_peekFor                                                                                    *
+ *                                                                                                                    *
+ * Description       : try to get access to the oldest mail in the mailbox queue object without copying,              *
+ *                     wait for given duration of time while the mailbox queue object is empty                        *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   box             : pointer to mailbox queue object                                                                *
+ *   data            : pointer to store the pointer to the oldest mail                                                *
+ *   delay           : duration of time (maximum number of ticks to wait while the mailbox queue object is empty)     *
+ *                     IMMEDIATE: don't wait if the mailbox queue object is empty                                     *
+ *                     INFINITE:  wait indefinitly while the mailbox queue object is empty                            *
+ *                                                                                                                    *
+ * Return                                                                                                             *
+ *   E_SUCCESS       : pointer to the oldest mail was successfully stored                                             *
+ *   E_STOPPED       : mailbox queue object was killed before the specified timeout expired                           *
+ *   E_TIMEOUT       : mailbox queue object is empty and was not received data before the specified timeout expired   *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+unsigned box_peekFor( box_t *box, void **data, uint32_t delay );
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : box_peek                                                                                       *
+ *                                                                                                                    *
+ * Description       : try to get access to the oldest mail in the mailbox queue object without copying,              *
+ *                     wait indefinitly while the mailbox queue object is empty                                       *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   box             : pointer to mailbox queue object                                                                *
+ *   data            : pointer to store the pointer to the oldest mail                                                *
+ *                                                                                                                    *
+ * Return                                                                                                             *
+ *   E_SUCCESS       : pointer to the oldest mail was successfully stored                                             *
+ *   E_STOPPED       : mailbox queue object was killed before the specified timeout expired                           *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+__STATIC_INLINE
+unsigned box_peek( box_t *box, void **data ) { return box_peekFor(box, data, INFINITE); }
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : box_release                                                                                    *
+ *                                                                                                                    *
+ * Description       : remove the oldest mail previously accessed with box_peek from the mailbox queue object,        *
+ *                     resume the first task waiting for a free mail slot                                             *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   box             : pointer to mailbox queue object                                                                *
+ *                                                                                                                    *
+ * Return            : none                                                                                           *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+void box_release( box_t *box );
+
 #ifdef __cplusplus
 }
 #endif
@@ -488,6 +771,59 @@ unsigned box_giveISR( box_t *box, const void *data ) { return box_sendFor(box, d
 
 #ifdef __cplusplus
 
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Class             : MailBoxCopyT                                                                                   *
+ *                                                                                                                    *
+ * Description       : procedure copying a single mail of given size, specialized at compile time                     *
+ *                     word by word and fully unrolled for mails up to 16 words                                       *
+ *                                                                                                                    *
+ * Template parameters                                                                                                *
+ *   size            : size of a single mail (in bytes)                                                               *
+ *   align           : alignment of mails (1: alignment is checked at run time)                                       *
+ *                                                                                                                    *
+ * Note              : for internal use                                                                               *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+template<unsigned _words>
+struct MailBoxWords
+{
+	static void copy( unsigned *_dst, const unsigned *_src ) { *_dst = *_src; MailBoxWords<_words - 1>::copy(_dst + 1, _src + 1); }
+};
+
+template<>
+struct MailBoxWords<0>
+{
+	static void copy( unsigned *, const unsigned * ) {}
+};
+
+template<unsigned _size, unsigned _align = 1>
+struct MailBoxCopyT
+{
+	static const unsigned _words = _size / sizeof(unsigned);
+
+	static void copy( void *_dst, const void *_src )
+	{
+		char       *dst = static_cast<char *>(_dst);
+		const char *src = static_cast<const char *>(_src);
+		unsigned    len = _size;
+
+		if ((_align % sizeof(unsigned) == 0) || ((reinterpret_cast<size_t>(dst) | reinterpret_cast<size_t>(src)) % sizeof(unsigned) == 0))
+		{
+			if (_words <= 16)
+				MailBoxWords<(_words <= 16 ? _words : 0)>::copy(reinterpret_cast<unsigned *>(dst), reinterpret_cast<const unsigned *>(src));
+			else
+				for (unsigned i = 0; i < _words; i++) reinterpret_cast<unsigned *>(dst)[i] = reinterpret_cast<const unsigned *>(src)[i];
+			dst += _words * sizeof(unsigned);
+			src += _words * sizeof(unsigned);
+			len -= _words * sizeof(unsigned);
+		}
+
+		while (len--) *dst++ = *src++;
+	}
+};
+
 /**********************************************************************************************************************
  *                                                                                                                    *
  * Class             : baseMailBoxQueue                                                                               *
@@ -511,6 +847,9 @@ struct baseMailBoxQueue : public __box
 
 	void     kill     ( void )                               {        box_kill     (this);                }
 	unsigned waitUntil(       void *_data, uint32_t _time  ) { return box_waitUntil(this, _data, _time);  }
+#if OS_TIME64
+	unsigned waitUntil64(       void *_data, uint64_t _time  ) { return box_waitUntil64(this, _data, _time);  }
+#endif
 	unsigned waitFor  (       void *_data, uint32_t _delay ) { return box_waitFor  (this, _data, _delay); }
 	unsigned wait     (       void *_data )                  { return box_wait     (this, _data);         }
 	unsigned take     (       void *_data )                  { return box_take     (this, _data);         }
@@ -520,6 +859,18 @@ struct baseMailBoxQueue : public __box
 	unsigned send     ( const void *_data )                  { return box_send     (this, _data);         }
 	unsigned give     ( const void *_data )                  { return box_give     (this, _data);         }
 	unsigned giveISR  ( const void *_data )                  { return box_giveISR  (this, _data);         }
+	unsigned sendMany   ( const void *_data, unsigned _count ) { return box_sendMany   (this, _data, _count); }
+	unsigned sendManyISR( const void *_data, unsigned _count ) { return box_sendManyISR(this, _data, _count); }
+	unsigned waitMany   (       void *_data, unsigned _count ) { return box_waitMany   (this, _data, _count); }
+	unsigned waitManyISR(       void *_data, unsigned _count ) { return box_waitManyISR(this, _data, _count); }
+	unsigned reserveUntil( void **_data, uint32_t _time  )   { return box_reserveUntil(this, _data, _time);  }
+	unsigned reserveFor  ( void **_data, uint32_t _delay )   { return box_reserveFor  (this, _data, _delay); }
+	unsigned reserve     ( void **_data )                    { return box_reserve     (this, _data);         }
+	void     commit      ( void )                            {        box_commit      (this);                }
+	unsigned peekUntil   ( void **_data, uint32_t _time  )   { return box_peekUntil   (this, _data, _time);  }
+	unsigned peekFor     ( void **_data, uint32_t _delay )   { return box_peekFor     (this, _data, _delay); }
+	unsigned peek        ( void **_data )                    { return box_peek        (this, _data);         }
+	void     release     ( void )                            {        box_release     (this);                }
 };
 
 /**********************************************************************************************************************
@@ -531,17 +882,20 @@ struct baseMailBoxQueue : public __box
  * Constructor parameters                                                                                             *
  *   limit           : size of a queue (max number of stored mails)                                                   *
  *   size            : size of a single mail (in bytes)                                                               *
+ *   align           : alignment of mails (optional, 1: alignment is checked at run time)                             *
  *                                                                                                                    *
  **********************************************************************************************************************/
 
-template<unsigned _limit, unsigned _size>
+template<unsigned _limit, unsigned _size, unsigned _align = 1>
 struct MailBoxQueueT : public baseMailBoxQueue
 {
+	static_assert(!OS_QUEUE_POW2 || (_limit & (_limit - 1)) == 0, "size of the queue must be a power of 2 (OS_QUEUE_POW2)");
+
 	explicit
-	MailBoxQueueT( void ): baseMailBoxQueue(_limit, _size, _data) {}
+	MailBoxQueueT( void ): baseMailBoxQueue(_limit, _size, reinterpret_cast<char *>(_data)) { copy = MailBoxCopyT<_size, _align>::copy; }
 
 	private:
-	char _data[_limit * _size];
+	stk_t _data[ASIZE(_limit * _size)];
 };
 
 /**********************************************************************************************************************
@@ -557,10 +911,79 @@ struct MailBoxQueueT : public baseMailBoxQueue
  **********************************************************************************************************************/
 
 template<unsigned _limit, class T>
-struct MailBoxQueueTT : public MailBoxQueueT<_limit, sizeof(T)>
+struct MailBoxQueueTT : public MailBoxQueueT<_limit, sizeof(T), alignof(T)>
 {
 	explicit
-	MailBoxQueueTT( void ): MailBoxQueueT<_limit, sizeof(T)>() {}
+	MailBoxQueueTT( void ): MailBoxQueueT<_limit, sizeof(T), alignof(T)>() {}
+};
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Class             : MailBoxWriter                                                                                  *
+ *                                                                                                                    *
+ * Description       : reserve a free mail slot in the mailbox queue object for the lifetime of the object,           *
+ *                     the mail written to the slot is appended to the mailbox queue object by the destructor         *
+ *                                                                                                                    *
+ * Constructor parameters                                                                                             *
+ *   box             : mailbox queue object                                                                           *
+ *   delay           : duration of time (maximum number of ticks to wait for a free mail slot, optional)              *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+struct MailBoxWriter
+{
+	 explicit
+	 MailBoxWriter( baseMailBoxQueue &_box, uint32_t _delay = INFINITE ): box(_box), data(nullptr) { event = box.reserveFor(&data, _delay); }
+	~MailBoxWriter( void ) { if (event == E_SUCCESS) box.commit(); }
+
+	void    *get   ( void ) { return data; }
+	unsigned result( void ) { return event; }
+	void     cancel( void ) { event = E_STOPPED; }
+	explicit operator bool( void ) { return event == E_SUCCESS; }
+
+	MailBoxWriter( const MailBoxWriter& ) = delete;
+	MailBoxWriter& operator=( const MailBoxWriter& ) = delete;
+
+	private:
+	baseMailBoxQueue &box;
+	void     *data;
+	unsigned  event;
+};
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Class             : MailBoxReader                                                                                  *
+ *                                                                                                                    *
+ * Description       : get access to the oldest mail in the mailbox queue object for the lifetime of the object,      *
+ *                     the mail is removed from the mailbox queue object by the destructor                            *
+ *                                                                                                                    *
+ * Constructor parameters                                                                                             *
+ *   box             : mailbox queue object                                                                           *
+ *   delay           : duration of time (maximum number of ticks to wait for a mail, optional)                        *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+struct MailBoxReader
+{
+	 explicit
+	 MailBoxReader( baseMailBoxQueue &_box, uint32_t _delay = INFINITE ): box(_box), data(nullptr) { event = box.peekFor(&data, _delay); }
+	~MailBoxReader( void ) { if (event == E_SUCCESS) box.release(); }
+
+	void    *get   ( void ) { return data; }
+	unsigned result( void ) { return event; }
+	explicit operator bool( void ) { return event == E_SUCCESS; }
+
+	MailBoxReader( const MailBoxReader& ) = delete;
+	MailBoxReader& operator=( const MailBoxReader& ) = delete;
+
+	private:
+	baseMailBoxQueue &box;
+	void     *data;
+	unsigned  event;
 };
 
 #endif
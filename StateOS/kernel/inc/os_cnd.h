@@ -214,6 +214,28 @@ void cnd_kill( cnd_t *cnd );
 
 void cnd_delete( cnd_t *cnd );
 
+#if OS_CND_CACHE
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : cnd_cacheStat                                                                                  *
+ *                                                                                                                    *
+ * Description       : get hit / miss counters of the cache of condition variable objects                             *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   hit             : pointer to store the number of objects allocated from the cache (can be null)                  *
+ *   miss            : pointer to store the number of objects allocated from the system heap (can be null)            *
+ *                                                                                                                    *
+ * Return            : none                                                                                           *
+ *                                                                                                                    *
+ * Note              : available if OS_CND_CACHE > 0                                                                  *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+void cnd_cacheStat( unsigned *hit, unsigned *miss );
+
+#endif
+
 /**********************************************************************************************************************
  *                                                                                                                    *
  * Name              : cnd_waitUntil                                                                                  *
@@ -237,6 +259,34 @@ void cnd_delete( cnd_t *cnd );
 
 unsigned cnd_waitUntil( cnd_t *cnd, mtx_t *mtx, uint32_t time );
 
+#if OS_TIME64
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : cnd_waitUntil64                                                                                *
+ *                                                                                                                    *
+ * Description       : wait until given timepoint on the condition variable releasing the currently owned mutex,      *
+ *                     and finally lock the mutex again                                                               *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   cnd             : pointer to condition variable object                                                           *
+ *   mtx             : currently owned mutex                                                                          *
+ *   time            : 64-bit timepoint value (sys_time64)                                                            *
+ *                                                                                                                    *
+ * Return                                                                                                             *
+ *   E_SUCCESS       : condition variable object was successfully signalled and owned mutex locked again              *
+ *   E_STOPPED       : condition variable object was killed before the specified timeout expired                      *
+ *   E_TIMEOUT       : condition variable object was not signalled before the specified timeout expired               *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                     available if OS_TIME64 > 0                                                                     *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+unsigned cnd_waitUntil64( cnd_t *cnd, mtx_t *mtx, uint64_t time );
+
+#endif
+
 /**********************************************************************************************************************
  *                                                                                                                    *
  * Name              : cnd_waitFor                                                                                    *
@@ -352,6 +402,9 @@ struct ConditionVariable : public __cnd
 
 	void     kill     ( void )                         {        cnd_kill     (this);               }
 	unsigned waitUntil( mtx_t *_mtx, uint32_t _time  ) { return cnd_waitUntil(this, _mtx, _time);  }
+#if OS_TIME64
+	unsigned waitUntil64( mtx_t *_mtx, uint64_t _time  ) { return cnd_waitUntil64(this, _mtx, _time);  }
+#endif
 	unsigned waitFor  ( mtx_t *_mtx, uint32_t _delay ) { return cnd_waitFor  (this, _mtx, _delay); }
 	unsigned wait     ( mtx_t *_mtx )                  { return cnd_wait     (this, _mtx);         }
 	void     give     ( bool   _all = cndAll )         {        cnd_give     (this, _all);         }
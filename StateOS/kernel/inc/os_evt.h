@@ -207,6 +207,28 @@ void evt_kill( evt_t *evt );
 
 void evt_delete( evt_t *evt );
 
+#if OS_EVT_CACHE
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : evt_cacheStat                                                                                  *
+ *                                                                                                                    *
+ * Description       : get hit / miss counters of the cache of event objects                                          *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   hit             : pointer to store the number of objects allocated from the cache (can be null)                  *
+ *   miss            : pointer to store the number of objects allocated from the system heap (can be null)            *
+ *                                                                                                                    *
+ * Return            : none                                                                                           *
+ *                                                                                                                    *
+ * Note              : available if OS_EVT_CACHE > 0                                                                  *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+void evt_cacheStat( unsigned *hit, unsigned *miss );
+
+#endif
+
 /**********************************************************************************************************************
  *                                                                                                                    *
  * Name              : evt_waitUntil                                                                                  *
@@ -228,6 +250,32 @@ void evt_delete( evt_t *evt );
 
 unsigned evt_waitUntil( evt_t *evt, uint32_t time );
 
+#if OS_TIME64
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : evt_waitUntil64                                                                                *
+ *                                                                                                                    *
+ * Description       : wait for release the event object until given timepoint                                        *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   evt             : pointer to event object                                                                        *
+ *   time            : 64-bit timepoint value (sys_time64)                                                            *
+ *                                                                                                                    *
+ * Return                                                                                                             *
+ *   E_STOPPED       : event object was killed before the specified timeout expired                                   *
+ *   E_TIMEOUT       : event object was not released before the specified timeout expired                             *
+ *   'another'       : event object was successfully released                                                         *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                     available if OS_TIME64 > 0                                                                     *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+unsigned evt_waitUntil64( evt_t *evt, uint64_t time );
+
+#endif
+
 /**********************************************************************************************************************
  *                                                                                                                    *
  * Name              : evt_waitFor                                                                                    *
@@ -335,6 +383,9 @@ struct Event : public __evt
 
 	void     kill     ( void )            {        evt_kill     (this);         }
 	unsigned waitUntil( uint32_t _time  ) { return evt_waitUntil(this, _time);  }
+#if OS_TIME64
+	unsigned waitUntil64( uint64_t _time  ) { return evt_waitUntil64(this, _time);  }
+#endif
 	unsigned waitFor  ( uint32_t _delay ) { return evt_waitFor  (this, _delay); }
 	unsigned wait     ( void )            { return evt_wait     (this);         }
 	void     give     ( unsigned _event ) {        evt_give     (this, _event); }
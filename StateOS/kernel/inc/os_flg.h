@@ -221,6 +221,28 @@ void flg_kill( flg_t *flg );
 
 void flg_delete( flg_t *flg );
 
+#if OS_FLG_CACHE
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : flg_cacheStat                                                                                  *
+ *                                                                                                                    *
+ * Description       : get hit / miss counters of the cache of flag objects                                           *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   hit             : pointer to store the number of objects allocated from the cache (can be null)                  *
+ *   miss            : pointer to store the number of objects allocated from the system heap (can be null)            *
+ *                                                                                                                    *
+ * Return            : none                                                                                           *
+ *                                                                                                                    *
+ * Note              : available if OS_FLG_CACHE > 0                                                                  *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+void flg_cacheStat( unsigned *hit, unsigned *miss );
+
+#endif
+
 /**********************************************************************************************************************
  *                                                                                                                    *
  * Name              : flg_waitUntil                                                                                  *
@@ -249,6 +271,39 @@ void flg_delete( flg_t *flg );
 
 unsigned flg_waitUntil( flg_t *flg, unsigned flags, unsigned mode, uint32_t time );
 
+#if OS_TIME64
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : flg_waitUntil64                                                                                *
+ *                                                                                                                    *
+ * Description       : wait on flag object for given flags until given timepoint                                      *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   flg             : pointer to flag object                                                                         *
+ *   flags           : all flags to wait                                                                              *
+ *   mode            : waiting mode                                                                                   *
+ *                     flgAny:     wait for any flags to be set                                                       *
+ *                     flgAll:     wait for all flags to be set                                                       *
+ *                     flgProtect: don't clear flags in flag object                                                   *
+ *                     flgIgnore:  ignore flags in flag object that have been set and not accepted before             *
+ *                     ( either flgAny or flgAll can be OR'ed with flgProtect or flgIgnore )                          *
+ *   time            : 64-bit timepoint value (sys_time64)                                                            *
+ *                                                                                                                    *
+ * Return                                                                                                             *
+ *   E_SUCCESS       : requested flags have been set before the specified timeout expired                             *
+ *   E_STOPPED       : flag object was killed before the specified timeout expired                                    *
+ *   E_TIMEOUT       : requested flags have not been set before the specified timeout expired                         *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                     available if OS_TIME64 > 0                                                                     *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+unsigned flg_waitUntil64( flg_t *flg, unsigned flags, unsigned mode, uint64_t time );
+
+#endif
+
 /**********************************************************************************************************************
  *                                                                                                                    *
  * Name              : flg_waitFor                                                                                    *
@@ -461,6 +516,9 @@ struct Flag : public __flg
 
 	void     kill     ( void )                                             {        flg_kill     (this);                        }
 	unsigned waitUntil( unsigned _flags, unsigned _mode, uint32_t _time )  { return flg_waitUntil(this, _flags, _mode, _time);  }
+#if OS_TIME64
+	unsigned waitUntil64( unsigned _flags, unsigned _mode, uint64_t _time ) { return flg_waitUntil64(this, _flags, _mode, _time);  }
+#endif
 	unsigned waitFor  ( unsigned _flags, unsigned _mode, uint32_t _delay ) { return flg_waitFor  (this, _flags, _mode, _delay); }
 	unsigned wait     ( unsigned _flags, unsigned _mode = flgAll )         { return flg_wait     (this, _flags, _mode);         }
 	unsigned take     ( unsigned _flags, unsigned _mode = flgAll )         { return flg_take     (this, _flags, _mode);         }
@@ -266,6 +266,33 @@ void job_delete( job_t *job );
 
 unsigned job_waitUntil( job_t *job, uint32_t time );
 
+#if OS_TIME64
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : job_waitUntil64                                                                                *
+ *                                                                                                                    *
+ * Description       : try to transfer job data from the job queue object and execute the job procedure,              *
+ *                     wait until given timepoint while the job queue object is empty                                 *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   job             : pointer to job queue object                                                                    *
+ *   time            : 64-bit timepoint value (sys_time64)                                                            *
+ *                                                                                                                    *
+ * Return                                                                                                             *
+ *   E_SUCCESS       : job data was successfully transfered from the job queue object                                 *
+ *   E_STOPPED       : job queue object was killed before the specified timeout expired                               *
+ *   E_TIMEOUT       : job queue object is empty and was not received data before the specified timeout expired       *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                     available if OS_TIME64 > 0                                                                     *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+unsigned job_waitUntil64( job_t *job, uint64_t time );
+
+#endif
+
 /**********************************************************************************************************************
  *                                                                                                                    *
  * Name              : job_waitFor                                                                                    *
@@ -446,6 +473,47 @@ unsigned job_give( job_t *job, fun_t *fun ) { return job_sendFor(job, fun, IMMED
 __STATIC_INLINE
 unsigned job_giveISR( job_t *job, fun_t *fun ) { return job_sendFor(job, fun, IMMEDIATE); }
 
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : job_sendMany                                                                                   *
+ *                                                                                                                    *
+ * Description       : try to transfer an array of job data to the job queue object,                                  *
+ *                     don't wait if the job queue object is full, wake each resumed task only once                   *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   job             : pointer to job queue object                                                                    *
+ *   data            : array of pointers to job procedures                                                            *
+ *   count           : number of elements in the array                                                                *
+ *                                                                                                                    *
+ * Return            : number of job data transfered to the job queue object                                          *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+unsigned job_sendMany( job_t *job, fun_t * const *data, unsigned count );
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : job_sendManyISR                                                                                *
+ *                                                                                                                    *
+ * Description       : try to transfer an array of job data to the job queue object,                                  *
+ *                     don't wait if the job queue object is full, wake each resumed task only once                   *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   job             : pointer to job queue object                                                                    *
+ *   data            : array of pointers to job procedures                                                            *
+ *   count           : number of elements in the array                                                                *
+ *                                                                                                                    *
+ * Return            : number of job data transfered to the job queue object                                          *
+ *                                                                                                                    *
+ * Note              : use only in handler mode                                                                       *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+__STATIC_INLINE
+unsigned job_sendManyISR( job_t *job, fun_t * const *data, unsigned count ) { return job_sendMany(job, data, count); }
+
 #ifdef __cplusplus
 }
 #endif
@@ -478,6 +546,9 @@ struct baseJobQueue : public __box
 
 	void     kill     ( void )                        {                              box_kill     (this);                                                              }
 	unsigned waitUntil( uint32_t _time )              { FUN_t _fun; unsigned event = box_waitUntil(this, &_fun, _time);  if (event == E_SUCCESS) _fun(); return event; }
+#if OS_TIME64
+	unsigned waitUntil64( uint64_t _time )            { FUN_t _fun; unsigned event = box_waitUntil64(this, &_fun, _time);  if (event == E_SUCCESS) _fun(); return event; }
+#endif
 	unsigned waitFor  ( uint32_t _delay )             { FUN_t _fun; unsigned event = box_waitFor  (this, &_fun, _delay); if (event == E_SUCCESS) _fun(); return event; }
 	unsigned wait     ( void )                        { FUN_t _fun; unsigned event = box_wait     (this, &_fun);         if (event == E_SUCCESS) _fun(); return event; }
 	unsigned take     ( void )                        { FUN_t _fun; unsigned event = box_take     (this, &_fun);         if (event == E_SUCCESS) _fun(); return event; }
@@ -486,6 +557,8 @@ struct baseJobQueue : public __box
 	unsigned send     ( FUN_t _fun )                  {             unsigned event = box_send     (this, &_fun);                                         return event; }
 	unsigned give     ( FUN_t _fun )                  {             unsigned event = box_give     (this, &_fun);                                         return event; }
 	unsigned giveISR  ( FUN_t _fun )                  {             unsigned event = box_giveISR  (this, &_fun);                                         return event; }
+	unsigned sendMany   ( const FUN_t *_fun, unsigned _count ) { return box_sendMany   (this, _fun, _count); }
+	unsigned sendManyISR( const FUN_t *_fun, unsigned _count ) { return box_sendManyISR(this, _fun, _count); }
 };
 
 #else
@@ -498,6 +571,9 @@ struct baseJobQueue : public __job
 
 	void     kill     ( void )                        {        job_kill     (this);               }
 	unsigned waitUntil( uint32_t _time )              { return job_waitUntil(this, _time);        }
+#if OS_TIME64
+	unsigned waitUntil64( uint64_t _time )            { return job_waitUntil64(this, _time);        }
+#endif
 	unsigned waitFor  ( uint32_t _delay )             { return job_waitFor  (this, _delay);       }
 	unsigned wait     ( void )                        { return job_wait     (this);               }
 	unsigned take     ( void )                        { return job_take     (this);               }
@@ -506,6 +582,8 @@ struct baseJobQueue : public __job
 	unsigned send     ( FUN_t _fun )                  { return job_send     (this, _fun);         }
 	unsigned give     ( FUN_t _fun )                  { return job_give     (this, _fun);         }
 	unsigned giveISR  ( FUN_t _fun )                  { return job_giveISR  (this, _fun);         }
+	unsigned sendMany   ( FUN_t const *_fun, unsigned _count ) { return job_sendMany   (this, _fun, _count); }
+	unsigned sendManyISR( FUN_t const *_fun, unsigned _count ) { return job_sendManyISR(this, _fun, _count); }
 };
 
 #endif
@@ -524,6 +602,8 @@ struct baseJobQueue : public __job
 template<unsigned _limit>
 struct JobQueueT : public baseJobQueue
 {
+	static_assert(!OS_QUEUE_POW2 || (_limit & (_limit - 1)) == 0, "size of the queue must be a power of 2 (OS_QUEUE_POW2)");
+
 	explicit
 	JobQueueT( void ): baseJobQueue(_limit, _data) {}
 
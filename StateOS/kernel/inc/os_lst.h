@@ -48,6 +48,7 @@ struct __lst
 	tsk_t  * queue; // next process in the DELAYED queue
 	void   * res;   // allocated list object's resource
 	que_t  * next;  // next memory object in the queue, previously created in the memory pool
+	que_t  * tail;  // last memory object in the queue
 };
 
 /**********************************************************************************************************************
@@ -64,7 +65,7 @@ struct __lst
  *                                                                                                                    *
  **********************************************************************************************************************/
 
-#define               _LST_INIT() { 0, 0, 0 }
+#define               _LST_INIT() { 0, 0, 0, 0 }
 
 /**********************************************************************************************************************
  *                                                                                                                    *
@@ -208,6 +209,28 @@ void lst_kill( lst_t *lst );
 
 void lst_delete( lst_t *lst );
 
+#if OS_LST_CACHE
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : lst_cacheStat                                                                                  *
+ *                                                                                                                    *
+ * Description       : get hit / miss counters of the cache of list objects                                           *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   hit             : pointer to store the number of objects allocated from the cache (can be null)                  *
+ *   miss            : pointer to store the number of objects allocated from the system heap (can be null)            *
+ *                                                                                                                    *
+ * Return            : none                                                                                           *
+ *                                                                                                                    *
+ * Note              : available if OS_LST_CACHE > 0                                                                  *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+void lst_cacheStat( unsigned *hit, unsigned *miss );
+
+#endif
+
 /**********************************************************************************************************************
  *                                                                                                                    *
  * Name              : lst_waitUntil                                                                                  *
@@ -231,6 +254,34 @@ void lst_delete( lst_t *lst );
 
 unsigned lst_waitUntil( lst_t *lst, void **data, uint32_t time );
 
+#if OS_TIME64
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : lst_waitUntil64                                                                                *
+ *                                                                                                                    *
+ * Description       : try to get memory object from the list object,                                                 *
+ *                     wait until given timepoint while the list object is empty                                      *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   lst             : pointer to list object                                                                         *
+ *   data            : pointer to store the pointer to the memory object                                              *
+ *   time            : 64-bit timepoint value (sys_time64)                                                            *
+ *                                                                                                                    *
+ * Return                                                                                                             *
+ *   E_SUCCESS       : pointer to memory object was successfully transfered to the data pointer                       *
+ *   E_STOPPED       : list object was killed before the specified timeout expired                                    *
+ *   E_TIMEOUT       : list object is empty and was not received data before the specified timeout expired            *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                     available if OS_TIME64 > 0                                                                     *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+unsigned lst_waitUntil64( lst_t *lst, void **data, uint64_t time );
+
+#endif
+
 /**********************************************************************************************************************
  *                                                                                                                    *
  * Name              : lst_waitFor                                                                                    *
@@ -386,6 +437,9 @@ struct List : public __lst
 
 	void     kill     ( void )                          {        lst_kill     (this);                }
 	unsigned waitUntil( void **_data, uint32_t _time )  { return lst_waitUntil(this, _data, _time);  }
+#if OS_TIME64
+	unsigned waitUntil64( void **_data, uint64_t _time ) { return lst_waitUntil64(this, _data, _time);  }
+#endif
 	unsigned waitFor  ( void **_data, uint32_t _delay ) { return lst_waitFor  (this, _data, _delay); }
 	unsigned wait     ( void **_data )                  { return lst_wait     (this, _data);         }
 	unsigned take     ( void **_data )                  { return lst_take     (this, _data);         }
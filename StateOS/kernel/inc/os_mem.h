@@ -52,6 +52,8 @@ struct __mem
 
 	unsigned size;  // size of memory object (in words)
 	void   * data;  // pointer to memory pool buffer
+	unsigned count; // number of free memory objects in the memory pool
+	bool     nozero; // memory objects are not zeroed on allocation
 };
 
 /* -------------------------------------------------------------------------- */
@@ -75,7 +77,7 @@ struct __mem
  *                                                                                                                    *
  **********************************************************************************************************************/
 
-#define               _MEM_INIT( _limit, _size, _data ) { 0, 0, 0, _limit, MSIZE(_size), _data }
+#define               _MEM_INIT( _limit, _size, _data ) { 0, 0, 0, _limit, MSIZE(_size), _data, 0, 0 }
 
 /**********************************************************************************************************************
  *                                                                                                                    *
@@ -271,6 +273,23 @@ void mem_kill( mem_t *mem );
 
 void mem_delete( mem_t *mem );
 
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : mem_setZero                                                                                    *
+ *                                                                                                                    *
+ * Description       : set zero-on-allocation mode of the memory pool object                                          *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   mem             : pointer to memory pool object                                                                  *
+ *   zero            : true: memory objects are zeroed on allocation (default)                                        *
+ *                     false: memory objects are not zeroed on allocation                                             *
+ *                                                                                                                    *
+ * Return            : none                                                                                           *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+void mem_setZero( mem_t *mem, bool zero );
+
 /**********************************************************************************************************************
  *                                                                                                                    *
  * Name              : mem_waitUntil                                                                                  *
@@ -294,6 +313,34 @@ void mem_delete( mem_t *mem );
 
 unsigned mem_waitUntil( mem_t *mem, void **data, uint32_t time );
 
+#if OS_TIME64
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : mem_waitUntil64                                                                                *
+ *                                                                                                                    *
+ * Description       : try to get memory object from the memory pool object,                                          *
+ *                     wait until given timepoint while the memory pool object is empty                               *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   mem             : pointer to memory pool object                                                                  *
+ *   data            : pointer to store the pointer to the memory object                                              *
+ *   time            : 64-bit timepoint value (sys_time64)                                                            *
+ *                                                                                                                    *
+ * Return                                                                                                             *
+ *   E_SUCCESS       : pointer to memory object was successfully transfered to the data pointer                       *
+ *   E_STOPPED       : memory pool object was killed before the specified timeout expired                             *
+ *   E_TIMEOUT       : memory pool object is empty and was not received data before the specified timeout expired     *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                     available if OS_TIME64 > 0                                                                     *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+unsigned mem_waitUntil64( mem_t *mem, void **data, uint64_t time );
+
+#endif
+
 /**********************************************************************************************************************
  *                                                                                                                    *
  * Name              : mem_waitFor                                                                                    *
@@ -452,7 +499,11 @@ struct baseMemoryPool : public __mem
 	~baseMemoryPool( void ) { assert(queue == nullptr); }
 
 	void     kill     ( void )                          {        mem_kill     (this);                }
+	void     setZero  ( bool  _zero )                   {        mem_setZero  (this, _zero);         }
 	unsigned waitUntil( void **_data, uint32_t _time )  { return mem_waitUntil(this, _data, _time);  }
+#if OS_TIME64
+	unsigned waitUntil64( void **_data, uint64_t _time ) { return mem_waitUntil64(this, _data, _time);  }
+#endif
 	unsigned waitFor  ( void **_data, uint32_t _delay ) { return mem_waitFor  (this, _data, _delay); }
 	unsigned wait     ( void **_data )                  { return mem_wait     (this, _data);         }
 	unsigned take     ( void **_data )                  { return mem_take     (this, _data);         }
@@ -502,6 +553,9 @@ struct MemoryPoolTT : public MemoryPoolT<_limit, sizeof(T)>
 	MemoryPoolTT( void ): MemoryPoolT<_limit, sizeof(T)>() {}
 
 	unsigned waitUntil( T **_data, uint32_t _time )  { return mem_waitUntil(this, reinterpret_cast<void **>(_data), _time);  }
+#if OS_TIME64
+	unsigned waitUntil64( T **_data, uint64_t _time ) { return mem_waitUntil64(this, reinterpret_cast<void **>(_data), _time);  }
+#endif
 	unsigned waitFor  ( T **_data, uint32_t _delay ) { return mem_waitFor  (this, reinterpret_cast<void **>(_data), _delay); }
 	unsigned wait     ( T **_data )                  { return mem_wait     (this, reinterpret_cast<void **>(_data));         }
 	unsigned take     ( T **_data )                  { return mem_take     (this, reinterpret_cast<void **>(_data));         }
@@ -267,6 +267,34 @@ void msg_delete( msg_t *msg );
 
 unsigned msg_waitUntil( msg_t *msg, unsigned *data, uint32_t time );
 
+#if OS_TIME64
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : msg_waitUntil64                                                                                *
+ *                                                                                                                    *
+ * Description       : try to transfer message data from the message queue object,                                    *
+ *                     wait until given timepoint while the message queue object is empty                             *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   msg             : pointer to message queue object                                                                *
+ *   data            : pointer to store message data                                                                  *
+ *   time            : 64-bit timepoint value (sys_time64)                                                            *
+ *                                                                                                                    *
+ * Return                                                                                                             *
+ *   E_SUCCESS       : message data was successfully transfered from the message queue object                         *
+ *   E_STOPPED       : message queue object was killed before the specified timeout expired                           *
+ *   E_TIMEOUT       : message queue object is empty and was not received data before the specified timeout expired   *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                     available if OS_TIME64 > 0                                                                     *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+unsigned msg_waitUntil64( msg_t *msg, unsigned *data, uint64_t time );
+
+#endif
+
 /**********************************************************************************************************************
  *                                                                                                                    *
  * Name              : msg_waitFor                                                                                    *
@@ -472,6 +500,88 @@ unsigned msg_give( msg_t *msg, unsigned data ) { return msg_sendFor(msg, data, I
 __STATIC_INLINE
 unsigned msg_giveISR( msg_t *msg, unsigned data ) { return msg_sendFor(msg, data, IMMEDIATE); }
 
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : msg_sendMany                                                                                   *
+ *                                                                                                                    *
+ * Description       : try to transfer an array of message data to the message queue object,                          *
+ *                     don't wait if the message queue object is full, wake each resumed task only once               *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   msg             : pointer to message queue object                                                                *
+ *   data            : array of message data                                                                          *
+ *   count           : number of elements in the array                                                                *
+ *                                                                                                                    *
+ * Return            : number of message data transfered to the message queue object                                  *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+unsigned msg_sendMany( msg_t *msg, const unsigned *data, unsigned count );
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : msg_sendManyISR                                                                                *
+ *                                                                                                                    *
+ * Description       : try to transfer an array of message data to the message queue object,                          *
+ *                     don't wait if the message queue object is full, wake each resumed task only once               *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   msg             : pointer to message queue object                                                                *
+ *   data            : array of message data                                                                          *
+ *   count           : number of elements in the array                                                                *
+ *                                                                                                                    *
+ * Return            : number of message data transfered to the message queue object                                  *
+ *                                                                                                                    *
+ * Note              : use only in handler mode                                                                       *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+__STATIC_INLINE
+unsigned msg_sendManyISR( msg_t *msg, const unsigned *data, unsigned count ) { return msg_sendMany(msg, data, count); }
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : msg_waitMany                                                                                   *
+ *                                                                                                                    *
+ * Description       : try to transfer an array of message data from the message queue object,                        *
+ *                     don't wait if the message queue object is empty, wake each resumed task only once              *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   msg             : pointer to message queue object                                                                *
+ *   data            : pointer to array to store message data                                                         *
+ *   count           : number of elements in the array                                                                *
+ *                                                                                                                    *
+ * Return            : number of message data transfered from the message queue object                                *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+unsigned msg_waitMany( msg_t *msg, unsigned *data, unsigned count );
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : msg_waitManyISR                                                                                *
+ *                                                                                                                    *
+ * Description       : try to transfer an array of message data from the message queue object,                        *
+ *                     don't wait if the message queue object is empty, wake each resumed task only once              *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   msg             : pointer to message queue object                                                                *
+ *   data            : pointer to array to store message data                                                         *
+ *   count           : number of elements in the array                                                                *
+ *                                                                                                                    *
+ * Return            : number of message data transfered from the message queue object                                *
+ *                                                                                                                    *
+ * Note              : use only in handler mode                                                                       *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+__STATIC_INLINE
+unsigned msg_waitManyISR( msg_t *msg, unsigned *data, unsigned count ) { return msg_waitMany(msg, data, count); }
+
 #ifdef __cplusplus
 }
 #endif
@@ -502,6 +612,9 @@ struct baseMessageQueue : public __msg
 
 	void     kill     ( void )                            {        msg_kill     (this);                }
 	unsigned waitUntil( unsigned*_data, uint32_t _time  ) { return msg_waitUntil(this, _data, _time);  }
+#if OS_TIME64
+	unsigned waitUntil64( unsigned*_data, uint64_t _time  ) { return msg_waitUntil64(this, _data, _time);  }
+#endif
 	unsigned waitFor  ( unsigned*_data, uint32_t _delay ) { return msg_waitFor  (this, _data, _delay); }
 	unsigned wait     ( unsigned*_data )                  { return msg_wait     (this, _data);         }
 	unsigned take     ( unsigned*_data )                  { return msg_take     (this, _data);         }
@@ -511,6 +624,10 @@ struct baseMessageQueue : public __msg
 	unsigned send     ( unsigned _data )                  { return msg_send     (this, _data);         }
 	unsigned give     ( unsigned _data )                  { return msg_give     (this, _data);         }
 	unsigned giveISR  ( unsigned _data )                  { return msg_giveISR  (this, _data);         }
+	unsigned sendMany   ( const unsigned*_data, unsigned _count ) { return msg_sendMany   (this, _data, _count); }
+	unsigned sendManyISR( const unsigned*_data, unsigned _count ) { return msg_sendManyISR(this, _data, _count); }
+	unsigned waitMany   (       unsigned*_data, unsigned _count ) { return msg_waitMany   (this, _data, _count); }
+	unsigned waitManyISR(       unsigned*_data, unsigned _count ) { return msg_waitManyISR(this, _data, _count); }
 };
 
 /**********************************************************************************************************************
@@ -527,6 +644,8 @@ struct baseMessageQueue : public __msg
 template<unsigned _limit>
 struct MessageQueueT : public baseMessageQueue
 {
+	static_assert(!OS_QUEUE_POW2 || (_limit & (_limit - 1)) == 0, "size of the queue must be a power of 2 (OS_QUEUE_POW2)");
+
 	explicit
 	MessageQueueT( void ): baseMessageQueue(_limit, _data) {}
 
@@ -50,7 +50,10 @@ struct __mtx
 	void   * res;   // allocated mutex object's resource
 	tsk_t  * owner; // owner task
 	unsigned count; // mutex's curent value
-	mtx_t  * list;  // list of mutexes held by owner
+	mtx_t  * list;  // next mutex in the list of mutexes held by owner
+	mtx_t  * back;  // previous mutex in the list of mutexes held by owner
+	unsigned prio;  // priority ceiling (0: priority inheritance protocol)
+	unsigned top;   // priority imposed on the owner: priority ceiling or priority of the first waiting task
 };
 
 /**********************************************************************************************************************
@@ -67,7 +70,24 @@ struct __mtx
  *                                                                                                                    *
  **********************************************************************************************************************/
 
-#define               _MTX_INIT() { 0, 0, 0, 0, 0 }
+#define               _MTX_INIT() { 0, 0, 0, 0, 0, 0, 0, 0 }
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : _MTX_INIT_CEILING                                                                              *
+ *                                                                                                                    *
+ * Description       : create and initilize a priority ceiling mutex object                                           *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   prio            : priority ceiling                                                                               *
+ *                                                                                                                    *
+ * Return            : mutex object                                                                                   *
+ *                                                                                                                    *
+ * Note              : for internal use                                                                               *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+#define               _MTX_INIT_CEILING( _prio ) { 0, 0, 0, 0, 0, 0, _prio, _prio }
 
 /**********************************************************************************************************************
  *                                                                                                                    *
@@ -99,6 +119,38 @@ struct __mtx
                 static mtx_t mtx##__mtx = _MTX_INIT(); \
                 static mtx_id mtx = & mtx##__mtx
 
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : OS_MTX_CEILING                                                                                 *
+ *                                                                                                                    *
+ * Description       : define and initilize a priority ceiling mutex object                                           *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   mtx             : name of a pointer to mutex object                                                              *
+ *   prio            : priority ceiling                                                                               *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+#define             OS_MTX_CEILING( mtx, prio )                     \
+                       mtx_t mtx##__mtx = _MTX_INIT_CEILING( prio ); \
+                       mtx_id mtx = & mtx##__mtx
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : static_MTX_CEILING                                                                             *
+ *                                                                                                                    *
+ * Description       : define and initilize a static priority ceiling mutex object                                    *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   mtx             : name of a pointer to mutex object                                                              *
+ *   prio            : priority ceiling                                                                               *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+#define         static_MTX_CEILING( mtx, prio )                     \
+                static mtx_t mtx##__mtx = _MTX_INIT_CEILING( prio ); \
+                static mtx_id mtx = & mtx##__mtx
+
 /**********************************************************************************************************************
  *                                                                                                                    *
  * Name              : MTX_INIT                                                                                       *
@@ -157,6 +209,25 @@ struct __mtx
 
 void mtx_init( mtx_t *mtx );
 
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : mtx_initCeiling                                                                                *
+ *                                                                                                                    *
+ * Description       : initilize a priority ceiling mutex object                                                      *
+ *                      the owner of the mutex object immediately gets priority not less than the priority ceiling    *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   mtx             : pointer to mutex object                                                                        *
+ *   prio            : priority ceiling (must not be less than priority of any task using the mutex)                  *
+ *                                                                                                                    *
+ * Return            : none                                                                                           *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+void mtx_initCeiling( mtx_t *mtx, unsigned prio );
+
 /**********************************************************************************************************************
  *                                                                                                                    *
  * Name              : mtx_create                                                                                     *
@@ -177,6 +248,27 @@ mtx_t *mtx_create( void );
 __STATIC_INLINE
 mtx_t *mtx_new   ( void ) { return mtx_create(); }
 
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : mtx_createCeiling                                                                              *
+ * Alias             : mtx_newCeiling                                                                                 *
+ *                                                                                                                    *
+ * Description       : create and initilize a new priority ceiling mutex object                                       *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   prio            : priority ceiling (must not be less than priority of any task using the mutex)                  *
+ *                                                                                                                    *
+ * Return            : pointer to mutex object (mutex successfully created)                                           *
+ *   0               : mutex not created (not enough free memory)                                                     *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+mtx_t *mtx_createCeiling( unsigned prio );
+__STATIC_INLINE
+mtx_t *mtx_newCeiling   ( unsigned prio ) { return mtx_createCeiling(prio); }
+
 /**********************************************************************************************************************
  *                                                                                                                    *
  * Name              : mtx_kill                                                                                       *
@@ -211,6 +303,28 @@ void mtx_kill( mtx_t *mtx );
 
 void mtx_delete( mtx_t *mtx );
 
+#if OS_MTX_CACHE
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : mtx_cacheStat                                                                                  *
+ *                                                                                                                    *
+ * Description       : get hit / miss counters of the cache of mutex objects                                          *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   hit             : pointer to store the number of objects allocated from the cache (can be null)                  *
+ *   miss            : pointer to store the number of objects allocated from the system heap (can be null)            *
+ *                                                                                                                    *
+ * Return            : none                                                                                           *
+ *                                                                                                                    *
+ * Note              : available if OS_MTX_CACHE > 0                                                                  *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+void mtx_cacheStat( unsigned *hit, unsigned *miss );
+
+#endif
+
 /**********************************************************************************************************************
  *                                                                                                                    *
  * Name              : mtx_waitUntil                                                                                  *
@@ -233,6 +347,33 @@ void mtx_delete( mtx_t *mtx );
 
 unsigned mtx_waitUntil( mtx_t *mtx, uint32_t time );
 
+#if OS_TIME64
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : mtx_waitUntil64                                                                                *
+ *                                                                                                                    *
+ * Description       : try to lock the mutex object,                                                                  *
+ *                     wait until given timepoint if the mutex object can't be locked immediately                     *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   mtx             : pointer to mutex object                                                                        *
+ *   time            : 64-bit timepoint value (sys_time64)                                                            *
+ *                                                                                                                    *
+ * Return                                                                                                             *
+ *   E_SUCCESS       : mutex object was successfully locked                                                           *
+ *   E_STOPPED       : mutex object was killed before the specified timeout expired                                   *
+ *   E_TIMEOUT       : mutex object was not locked before the specified timeout expired                               *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                     available if OS_TIME64 > 0                                                                     *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+unsigned mtx_waitUntil64( mtx_t *mtx, uint64_t time );
+
+#endif
+
 /**********************************************************************************************************************
  *                                                                                                                    *
  * Name              : mtx_waitFor                                                                                    *
@@ -334,18 +475,22 @@ unsigned mtx_give( mtx_t *mtx );
  * Description       : create and initilize a mutex object                                                            *
  *                                                                                                                    *
  * Constructor parameters                                                                                             *
- *                   : none                                                                                           *
+ *   prio            : priority ceiling                                                                               *
+ *                     0: priority inheritance protocol (default)                                                     *
  *                                                                                                                    *
  **********************************************************************************************************************/
 
 struct Mutex : public __mtx
 {
 	 explicit
-	 Mutex( void ): __mtx _MTX_INIT() {}
+	 Mutex( const unsigned _prio = 0 ): __mtx _MTX_INIT_CEILING(_prio) {}
 	~Mutex( void ) { assert(owner == nullptr); }
 
 	void     kill     ( void )            {        mtx_kill     (this);         }
 	unsigned waitUntil( uint32_t _time  ) { return mtx_waitUntil(this, _time);  }
+#if OS_TIME64
+	unsigned waitUntil64( uint64_t _time  ) { return mtx_waitUntil64(this, _time);  }
+#endif
 	unsigned waitFor  ( uint32_t _delay ) { return mtx_waitFor  (this, _delay); }
 	unsigned wait     ( void )            { return mtx_wait     (this);         }
 	unsigned take     ( void )            { return mtx_take     (this);         }
@@ -210,6 +210,28 @@ void mut_kill( mut_t *mut );
 
 void mut_delete( mut_t *mut );
 
+#if OS_MUT_CACHE
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : mut_cacheStat                                                                                  *
+ *                                                                                                                    *
+ * Description       : get hit / miss counters of the cache of fast mutex objects                                     *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   hit             : pointer to store the number of objects allocated from the cache (can be null)                  *
+ *   miss            : pointer to store the number of objects allocated from the system heap (can be null)            *
+ *                                                                                                                    *
+ * Return            : none                                                                                           *
+ *                                                                                                                    *
+ * Note              : available if OS_MUT_CACHE > 0                                                                  *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+void mut_cacheStat( unsigned *hit, unsigned *miss );
+
+#endif
+
 /**********************************************************************************************************************
  *                                                                                                                    *
  * Name              : mut_waitUntil                                                                                  *
@@ -232,6 +254,33 @@ void mut_delete( mut_t *mut );
 
 unsigned mut_waitUntil( mut_t *mut, uint32_t time );
 
+#if OS_TIME64
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : mut_waitUntil64                                                                                *
+ *                                                                                                                    *
+ * Description       : try to lock the fast mutex object,                                                             *
+ *                     wait until given timepoint if the fast mutex object can't be locked immediately                *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   mut             : pointer to fast mutex object                                                                   *
+ *   time            : 64-bit timepoint value (sys_time64)                                                            *
+ *                                                                                                                    *
+ * Return                                                                                                             *
+ *   E_SUCCESS       : fast mutex object was successfully locked                                                      *
+ *   E_STOPPED       : fast mutex object was killed before the specified timeout expired                              *
+ *   E_TIMEOUT       : fast mutex object was not locked before the specified timeout expired                          *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                     available if OS_TIME64 > 0                                                                     *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+unsigned mut_waitUntil64( mut_t *mut, uint64_t time );
+
+#endif
+
 /**********************************************************************************************************************
  *                                                                                                                    *
  * Name              : mut_waitFor                                                                                    *
@@ -345,6 +394,9 @@ struct FastMutex : public __mut
 
 	void     kill     ( void )            {        mut_kill     (this);         }
 	unsigned waitUntil( uint32_t _time  ) { return mut_waitUntil(this, _time);  }
+#if OS_TIME64
+	unsigned waitUntil64( uint64_t _time  ) { return mut_waitUntil64(this, _time);  }
+#endif
 	unsigned waitFor  ( uint32_t _delay ) { return mut_waitFor  (this, _delay); }
 	unsigned wait     ( void )            { return mut_wait     (this);         }
 	unsigned take     ( void )            { return mut_take     (this);         }
@@ -0,0 +1,554 @@
+/******************************************************************************
+
+    @file    StateOS: os_pol.h
+    @author  Rajmund Szymanski
+    @date    24.10.2017
+    @brief   This file contains definitions for StateOS.
+
+ ******************************************************************************
+
+    StateOS - Copyright (C) 2013 Rajmund Szymanski.
+
+    This file is part of StateOS distribution.
+
+    StateOS is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published
+    by the Free Software Foundation; either version 3 of the License,
+    or (at your option) any later version.
+
+    StateOS is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+ ******************************************************************************/
+
+#ifndef __STATEOS_POL_H
+#define __STATEOS_POL_H
+
+#include "oskernel.h"
+#include "os_box.h"
+#include "os_tsk.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : job pool                                                                                       *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+typedef struct __pol pol_t, * const pol_id;
+
+typedef         void act_t( void * ); // job pool procedure
+
+typedef struct __pjb pjb_t;
+
+struct __pjb
+{
+	act_t  * fun;   // job procedure
+	void   * arg;   // argument of the job procedure
+};
+
+struct __pol
+{
+	box_t    box;   // queue of jobs, inherited from mailbox queue
+
+	unsigned prio;  // priority of worker tasks
+	unsigned num;   // number of worker tasks
+	unsigned size;  // size of private stack of a worker task (in bytes)
+	char   * work;  // work area of worker tasks
+	bool     init;  // worker tasks have been initialized, the work area is valid
+
+	unsigned done;  // number of executed jobs
+	unsigned peak;  // max number of queued jobs
+};
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : _POL_SLOT                                                                                      *
+ *                                                                                                                    *
+ * Description       : size of work area of a single worker task (task object and its private stack)                  *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   size            : size of private stack of a worker task (in bytes)                                              *
+ *                                                                                                                    *
+ * Return            : size of work area of a single worker task (in bytes)                                           *
+ *                                                                                                                    *
+ * Note              : for internal use                                                                               *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+#define               _POL_SLOT( _size ) \
+                       ( ABOVE( sizeof(tsk_t) ) + ABOVE( _size ) )
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : _POL_SIZE                                                                                      *
+ *                                                                                                                    *
+ * Description       : size of job pool data buffer                                                                   *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   workers         : number of worker tasks                                                                         *
+ *   size            : size of private stack of a worker task (in bytes)                                              *
+ *   limit           : size of a queue (max number of stored jobs)                                                    *
+ *                                                                                                                    *
+ * Return            : size of job pool data buffer (in bytes)                                                        *
+ *                                                                                                                    *
+ * Note              : for internal use                                                                               *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+#define               _POL_SIZE( _workers, _size, _limit ) \
+                       ( (_workers) * _POL_SLOT( _size ) + (_limit) * sizeof(pjb_t) )
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : _POL_INIT                                                                                      *
+ *                                                                                                                    *
+ * Description       : create and initilize a job pool object                                                         *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   workers         : number of worker tasks                                                                         *
+ *   prio            : priority of worker tasks (any unsigned int value)                                              *
+ *   size            : size of private stack of a worker task (in bytes)                                              *
+ *   limit           : size of a queue (max number of stored jobs)                                                    *
+ *   data            : job pool data buffer                                                                           *
+ *                                                                                                                    *
+ * Return            : job pool object                                                                                *
+ *                                                                                                                    *
+ * Note              : for internal use                                                                               *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+#define               _POL_INIT( _workers, _prio, _size, _limit, _data ) \
+                     { _BOX_INIT( _limit, sizeof(pjb_t), (char *)(_data) + (_workers) * _POL_SLOT( _size ) ), _prio, _workers, _size, (char *)(_data), false, 0, 0 }
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : _POL_DATA                                                                                      *
+ *                                                                                                                    *
+ * Description       : create a job pool data buffer                                                                  *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   workers         : number of worker tasks                                                                         *
+ *   prio            : priority of worker tasks (any unsigned int value)                                              *
+ *   size            : size of private stack of a worker task (in bytes)                                              *
+ *   limit           : size of a queue (max number of stored jobs)                                                    *
+ *                                                                                                                    *
+ * Return            : job pool data buffer                                                                           *
+ *                                                                                                                    *
+ * Note              : for internal use                                                                               *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+#ifndef __cplusplus
+#define               _POL_DATA( _workers, _size, _limit ) (stk_t[ASIZE(_POL_SIZE( _workers, _size, _limit ))]){ 0 }
+#endif
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : OS_POL                                                                                         *
+ *                                                                                                                    *
+ * Description       : define and initilize a job pool object                                                         *
+ *                     worker tasks must be started with pol_start function                                           *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   pol             : name of a pointer to job pool object                                                           *
+ *   workers         : number of worker tasks                                                                         *
+ *   prio            : priority of worker tasks (any unsigned int value)                                              *
+ *   size            : size of private stack of a worker task (in bytes)                                              *
+ *   limit           : size of a queue (max number of stored jobs)                                                    *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+#define             OS_POL( pol, workers, prio, size, limit )                                        \
+                       stk_t pol##__buf[ASIZE(_POL_SIZE( workers, size, limit ))];                         \
+                       pol_t pol##__pol = _POL_INIT( workers, prio, size, limit, pol##__buf ); \
+                       pol_id pol = & pol##__pol
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : static_POL                                                                                     *
+ *                                                                                                                    *
+ * Description       : define and initilize a static job pool object                                                  *
+ *                     worker tasks must be started with pol_start function                                           *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   pol             : name of a pointer to job pool object                                                           *
+ *   workers         : number of worker tasks                                                                         *
+ *   prio            : priority of worker tasks (any unsigned int value)                                              *
+ *   size            : size of private stack of a worker task (in bytes)                                              *
+ *   limit           : size of a queue (max number of stored jobs)                                                    *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+#define         static_POL( pol, workers, prio, size, limit )                                        \
+                static stk_t pol##__buf[ASIZE(_POL_SIZE( workers, size, limit ))];                         \
+                static pol_t pol##__pol = _POL_INIT( workers, prio, size, limit, pol##__buf ); \
+                static pol_id pol = & pol##__pol
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : POL_INIT                                                                                       *
+ *                                                                                                                    *
+ * Description       : create and initilize a job pool object                                                         *
+ *                     worker tasks must be started with pol_start function                                           *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   workers         : number of worker tasks                                                                         *
+ *   prio            : priority of worker tasks (any unsigned int value)                                              *
+ *   size            : size of private stack of a worker task (in bytes)                                              *
+ *   limit           : size of a queue (max number of stored jobs)                                                    *
+ *                                                                                                                    *
+ * Return            : job pool object                                                                                *
+ *                                                                                                                    *
+ * Note              : use only in 'C' code                                                                           *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+#ifndef __cplusplus
+#define                POL_INIT( workers, prio, size, limit ) \
+                      _POL_INIT( workers, prio, size, limit, _POL_DATA( workers, size, limit ) )
+#endif
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : POL_CREATE                                                                                     *
+ * Alias             : POL_NEW                                                                                        *
+ *                                                                                                                    *
+ * Description       : create and initilize a job pool object                                                         *
+ *                     worker tasks must be started with pol_start function                                           *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   workers         : number of worker tasks                                                                         *
+ *   prio            : priority of worker tasks (any unsigned int value)                                              *
+ *   size            : size of private stack of a worker task (in bytes)                                              *
+ *   limit           : size of a queue (max number of stored jobs)                                                    *
+ *                                                                                                                    *
+ * Return            : pointer to job pool object                                                                     *
+ *                                                                                                                    *
+ * Note              : use only in 'C' code                                                                           *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+#ifndef __cplusplus
+#define                POL_CREATE( workers, prio, size, limit ) \
+             & (pol_t) POL_INIT  ( workers, prio, size, limit )
+#define                POL_NEW \
+                       POL_CREATE
+#endif
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : pol_init                                                                                       *
+ *                                                                                                                    *
+ * Description       : initilize a job pool object and start its worker tasks                                         *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   pol             : pointer to job pool object                                                                     *
+ *   workers         : number of worker tasks                                                                         *
+ *   prio            : priority of worker tasks (any unsigned int value)                                              *
+ *   size            : size of private stack of a worker task (in bytes)                                              *
+ *   limit           : size of a queue (max number of stored jobs)                                                    *
+ *   data            : job pool data buffer (_POL_SIZE bytes, aligned to stk_t)                                       *
+ *                                                                                                                    *
+ * Return            : none                                                                                           *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+void pol_init( pol_t *pol, unsigned workers, unsigned prio, unsigned size, unsigned limit, void *data );
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : pol_create                                                                                     *
+ * Alias             : pol_new                                                                                        *
+ *                                                                                                                    *
+ * Description       : create and initilize a new job pool object and start its worker tasks                          *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   workers         : number of worker tasks                                                                         *
+ *   prio            : priority of worker tasks (any unsigned int value)                                              *
+ *   size            : size of private stack of a worker task (in bytes)                                              *
+ *   limit           : size of a queue (max number of stored jobs)                                                    *
+ *                                                                                                                    *
+ * Return            : pointer to job pool object (job pool successfully created)                                     *
+ *   0               : job pool not created (not enough free memory)                                                  *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+pol_t *pol_create( unsigned workers, unsigned prio, unsigned size, unsigned limit );
+__STATIC_INLINE
+pol_t *pol_new   ( unsigned workers, unsigned prio, unsigned size, unsigned limit ) { return pol_create(workers, prio, size, limit); }
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : pol_start                                                                                      *
+ *                                                                                                                    *
+ * Description       : start all stopped worker tasks of the job pool object                                          *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   pol             : pointer to job pool object                                                                     *
+ *                                                                                                                    *
+ * Return            : none                                                                                           *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+void pol_start( pol_t *pol );
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : pol_kill                                                                                       *
+ *                                                                                                                    *
+ * Description       : stop all worker tasks of the job pool object, reset the job pool object                        *
+ *                     and wake up all waiting tasks with 'E_STOPPED' event value                                     *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   pol             : pointer to job pool object                                                                     *
+ *                                                                                                                    *
+ * Return            : none                                                                                           *
+ *                                                                                                                    *
+ * Note              : use only in thread mode, don't use in a worker task of the job pool object                     *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+void pol_kill( pol_t *pol );
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : pol_delete                                                                                     *
+ *                                                                                                                    *
+ * Description       : stop all worker tasks, reset the job pool object and free allocated resource                   *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   pol             : pointer to job pool object                                                                     *
+ *                                                                                                                    *
+ * Return            : none                                                                                           *
+ *                                                                                                                    *
+ * Note              : use only in thread mode, don't use in a worker task of the job pool object                     *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+void pol_delete( pol_t *pol );
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : pol_sendUntil                                                                                  *
+ *                                                                                                                    *
+ * Description       : try to transfer job to the job pool object,                                                    *
+ *                     wait until given timepoint while the job pool object is full                                   *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   pol             : pointer to job pool object                                                                     *
+ *   fun             : pointer to job procedure                                                                       *
+ *   arg             : argument passed to the job procedure                                                           *
+ *   time            : timepoint value                                                                                *
+ *                                                                                                                    *
+ * Return                                                                                                             *
+ *   E_SUCCESS       : job was successfully transfered to the job pool object                                         *
+ *   E_STOPPED       : job pool object was killed before the specified timeout expired                                *
+ *   E_TIMEOUT       : job pool object is full and was not issued data before the specified timeout expired           *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+unsigned pol_sendUntil( pol_t *pol, act_t *fun, void *arg, uint32_t time );
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : pol_sendFor                                                                                    *
+ *                                                                                                                    *
+ * Description       : try to transfer job to the job pool object,                                                    *
+ *                     wait for given duration of time while the job pool object is full                              *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   pol             : pointer to job pool object                                                                     *
+ *   fun             : pointer to job procedure                                                                       *
+ *   arg             : argument passed to the job procedure                                                           *
+ *   delay           : duration of time (maximum number of ticks to wait while the job pool object is full)           *
+ *                     IMMEDIATE: don't wait if the job pool object is full                                           *
+ *                     INFINITE:  wait indefinitly while the job pool object is full                                  *
+ *                                                                                                                    *
+ * Return                                                                                                             *
+ *   E_SUCCESS       : job was successfully transfered to the job pool object                                         *
+ *   E_STOPPED       : job pool object was killed before the specified timeout expired                                *
+ *   E_TIMEOUT       : job pool object is full and was not issued data before the specified timeout expired           *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+unsigned pol_sendFor( pol_t *pol, act_t *fun, void *arg, uint32_t delay );
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : pol_send                                                                                       *
+ *                                                                                                                    *
+ * Description       : try to transfer job to the job pool object,                                                    *
+ *                     wait indefinitly while the job pool object is full                                             *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   pol             : pointer to job pool object                                                                     *
+ *   fun             : pointer to job procedure                                                                       *
+ *   arg             : argument passed to the job procedure                                                           *
+ *                                                                                                                    *
+ * Return                                                                                                             *
+ *   E_SUCCESS       : job was successfully transfered to the job pool object                                         *
+ *   E_STOPPED       : job pool object was killed                                                                     *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+__STATIC_INLINE
+unsigned pol_send( pol_t *pol, act_t *fun, void *arg ) { return pol_sendFor(pol, fun, arg, INFINITE); }
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : pol_give                                                                                       *
+ *                                                                                                                    *
+ * Description       : try to transfer job to the job pool object,                                                    *
+ *                     don't wait if the job pool object is full                                                      *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   pol             : pointer to job pool object                                                                     *
+ *   fun             : pointer to job procedure                                                                       *
+ *   arg             : argument passed to the job procedure                                                           *
+ *                                                                                                                    *
+ * Return                                                                                                             *
+ *   E_SUCCESS       : job was successfully transfered to the job pool object                                         *
+ *   E_TIMEOUT       : job pool object is full                                                                        *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+__STATIC_INLINE
+unsigned pol_give( pol_t *pol, act_t *fun, void *arg ) { return pol_sendFor(pol, fun, arg, IMMEDIATE); }
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : pol_giveISR                                                                                    *
+ *                                                                                                                    *
+ * Description       : try to transfer job to the job pool object,                                                    *
+ *                     don't wait if the job pool object is full                                                      *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   pol             : pointer to job pool object                                                                     *
+ *   fun             : pointer to job procedure                                                                       *
+ *   arg             : argument passed to the job procedure                                                           *
+ *                                                                                                                    *
+ * Return                                                                                                             *
+ *   E_SUCCESS       : job was successfully transfered to the job pool object                                         *
+ *   E_TIMEOUT       : job pool object is full                                                                        *
+ *                                                                                                                    *
+ * Note              : use only in handler mode                                                                       *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+__STATIC_INLINE
+unsigned pol_giveISR( pol_t *pol, act_t *fun, void *arg ) { return pol_sendFor(pol, fun, arg, IMMEDIATE); }
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : pol_stat                                                                                       *
+ *                                                                                                                    *
+ * Description       : get statistics of the job pool object                                                          *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   pol             : pointer to job pool object                                                                     *
+ *   done            : pointer to store the number of executed jobs (can be null)                                     *
+ *   count           : pointer to store the current number of queued jobs (can be null)                               *
+ *   peak            : pointer to store the max number of queued jobs (can be null)                                   *
+ *                                                                                                                    *
+ * Return            : none                                                                                           *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+void pol_stat( pol_t *pol, unsigned *done, unsigned *count, unsigned *peak );
+
+#ifdef __cplusplus
+}
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifdef __cplusplus
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Class             : baseJobPool                                                                                    *
+ *                                                                                                                    *
+ * Description       : create and initilize a job pool object                                                         *
+ *                                                                                                                    *
+ * Constructor parameters                                                                                             *
+ *   workers         : number of worker tasks                                                                         *
+ *   prio            : priority of worker tasks (any unsigned int value)                                              *
+ *   size            : size of private stack of a worker task (in bytes)                                              *
+ *   limit           : size of a queue (max number of stored jobs)                                                    *
+ *   data            : job pool data buffer                                                                           *
+ *                                                                                                                    *
+ * Note              : for internal use                                                                               *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+struct baseJobPool : public __pol
+{
+	 explicit
+	 baseJobPool( const unsigned _workers, const unsigned _prio, const unsigned _size, const unsigned _limit, stk_t * const _data ): __pol _POL_INIT(_workers, _prio, _size, _limit, _data) {}
+	~baseJobPool( void ) { assert(box.queue == nullptr); }
+
+	void     start    ( void )                                  {        pol_start    (this);                     }
+	void     kill     ( void )                                  {        pol_kill     (this);                     }
+	unsigned sendUntil( act_t *_fun, void *_arg, uint32_t _time  ) { return pol_sendUntil(this, _fun, _arg, _time);  }
+	unsigned sendFor  ( act_t *_fun, void *_arg, uint32_t _delay ) { return pol_sendFor  (this, _fun, _arg, _delay); }
+	unsigned send     ( act_t *_fun, void *_arg )                  { return pol_send     (this, _fun, _arg);         }
+	unsigned give     ( act_t *_fun, void *_arg )                  { return pol_give     (this, _fun, _arg);         }
+	unsigned giveISR  ( act_t *_fun, void *_arg )                  { return pol_giveISR  (this, _fun, _arg);         }
+	void     stat     ( unsigned *_done, unsigned *_count, unsigned *_peak ) { pol_stat(this, _done, _count, _peak); }
+};
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Class             : JobPool                                                                                        *
+ *                                                                                                                    *
+ * Description       : create and initilize a job pool object                                                         *
+ *                     worker tasks must be started with the start method                                             *
+ *                                                                                                                    *
+ * Constructor parameters                                                                                             *
+ *   workers         : number of worker tasks                                                                         *
+ *   limit           : size of a queue (max number of stored jobs)                                                    *
+ *   size            : size of private stack of a worker task (in bytes, optional)                                    *
+ *   prio            : priority of worker tasks (any unsigned int value)                                              *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+template<unsigned _workers, unsigned _limit, unsigned _size = OS_STACK_SIZE>
+struct JobPoolT : public baseJobPool
+{
+	static_assert(!OS_QUEUE_POW2 || (_limit & (_limit - 1)) == 0, "size of the queue must be a power of 2 (OS_QUEUE_POW2)");
+
+	explicit
+	JobPoolT( const unsigned _prio ): baseJobPool(_workers, _prio, _size, _limit, _data) {}
+
+	private:
+	stk_t _data[ASIZE(_POL_SIZE(_workers, _size, _limit))];
+};
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#endif//__STATEOS_POL_H
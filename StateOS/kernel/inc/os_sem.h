@@ -257,6 +257,28 @@ void sem_kill( sem_t *sem );
 
 void sem_delete( sem_t *sem );
 
+#if OS_SEM_CACHE
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : sem_cacheStat                                                                                  *
+ *                                                                                                                    *
+ * Description       : get hit / miss counters of the cache of semaphore objects                                      *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   hit             : pointer to store the number of objects allocated from the cache (can be null)                  *
+ *   miss            : pointer to store the number of objects allocated from the system heap (can be null)            *
+ *                                                                                                                    *
+ * Return            : none                                                                                           *
+ *                                                                                                                    *
+ * Note              : available if OS_SEM_CACHE > 0                                                                  *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+void sem_cacheStat( unsigned *hit, unsigned *miss );
+
+#endif
+
 /**********************************************************************************************************************
  *                                                                                                                    *
  * Name              : sem_waitUntil                                                                                  *
@@ -279,6 +301,33 @@ void sem_delete( sem_t *sem );
 
 unsigned sem_waitUntil( sem_t *sem, uint32_t time );
 
+#if OS_TIME64
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : sem_waitUntil64                                                                                *
+ *                                                                                                                    *
+ * Description       : try to lock the semaphore object,                                                              *
+ *                     wait until given timepoint if the semaphore object can't be locked immediately                 *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   sem             : pointer to semaphore object                                                                    *
+ *   time            : 64-bit timepoint value (sys_time64)                                                            *
+ *                                                                                                                    *
+ * Return                                                                                                             *
+ *   E_SUCCESS       : semaphore object was successfully locked                                                       *
+ *   E_STOPPED       : semaphore object was killed before the specified timeout expired                               *
+ *   E_TIMEOUT       : semaphore object was not locked before the specified timeout expired                           *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                     available if OS_TIME64 > 0                                                                     *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+unsigned sem_waitUntil64( sem_t *sem, uint64_t time );
+
+#endif
+
 /**********************************************************************************************************************
  *                                                                                                                    *
  * Name              : sem_waitFor                                                                                    *
@@ -506,6 +555,9 @@ struct Semaphore : public __sem
 
 	void     kill     ( void )            {        sem_kill     (this);         }
 	unsigned waitUntil( uint32_t _time )  { return sem_waitUntil(this, _time);  }
+#if OS_TIME64
+	unsigned waitUntil64( uint64_t _time ) { return sem_waitUntil64(this, _time);  }
+#endif
 	unsigned waitFor  ( uint32_t _delay ) { return sem_waitFor  (this, _delay); }
 	unsigned wait     ( void )            { return sem_wait     (this);         }
 	unsigned take     ( void )            { return sem_take     (this);         }
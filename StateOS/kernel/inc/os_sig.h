@@ -236,6 +236,28 @@ void sig_kill( sig_t *sig );
 
 void sig_delete( sig_t *sig );
 
+#if OS_SIG_CACHE
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : sig_cacheStat                                                                                  *
+ *                                                                                                                    *
+ * Description       : get hit / miss counters of the cache of signal objects                                         *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   hit             : pointer to store the number of objects allocated from the cache (can be null)                  *
+ *   miss            : pointer to store the number of objects allocated from the system heap (can be null)            *
+ *                                                                                                                    *
+ * Return            : none                                                                                           *
+ *                                                                                                                    *
+ * Note              : available if OS_SIG_CACHE > 0                                                                  *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+void sig_cacheStat( unsigned *hit, unsigned *miss );
+
+#endif
+
 /**********************************************************************************************************************
  *                                                                                                                    *
  * Name              : sig_waitUntil                                                                                  *
@@ -257,6 +279,32 @@ void sig_delete( sig_t *sig );
 
 unsigned sig_waitUntil( sig_t *sig, uint32_t time );
 
+#if OS_TIME64
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : sig_waitUntil64                                                                                *
+ *                                                                                                                    *
+ * Description       : wait for release the signal object until given timepoint                                       *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   sig             : pointer to signal object                                                                       *
+ *   time            : 64-bit timepoint value (sys_time64)                                                            *
+ *                                                                                                                    *
+ * Return                                                                                                             *
+ *   E_SUCCESS       : signal object was successfully released                                                        *
+ *   E_STOPPED       : signal object was killed before the specified timeout expired                                  *
+ *   E_TIMEOUT       : signal object was not released before the specified timeout expired                            *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                     available if OS_TIME64 > 0                                                                     *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+unsigned sig_waitUntil64( sig_t *sig, uint64_t time );
+
+#endif
+
 /**********************************************************************************************************************
  *                                                                                                                    *
  * Name              : sig_waitFor                                                                                    *
@@ -440,6 +488,9 @@ struct Signal : public __sig
 
 	void     kill     ( void )            {        sig_kill     (this);         }
 	unsigned waitUntil( uint32_t _time  ) { return sig_waitUntil(this, _time);  }
+#if OS_TIME64
+	unsigned waitUntil64( uint64_t _time  ) { return sig_waitUntil64(this, _time);  }
+#endif
 	unsigned waitFor  ( uint32_t _delay ) { return sig_waitFor  (this, _delay); }
 	unsigned wait     ( void )            { return sig_wait     (this);         }
 	unsigned take     ( void )            { return sig_take     (this);         }
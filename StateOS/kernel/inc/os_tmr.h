@@ -49,6 +49,13 @@ struct __tmr
 	uint32_t start;
 	uint32_t delay;
 	uint32_t period;
+	uint32_t slack; // maximum extension of the countdown of each expiration
+#if OS_TMR_TASK
+	bool     isr;   // callback procedure is executed in handler mode
+#endif
+#if OS_TIME64
+	uint32_t hops;  // number of remaining half periods of the system counter to countdown before expiration
+#endif
 };
 
 /**********************************************************************************************************************
@@ -67,7 +74,19 @@ struct __tmr
  *                                                                                                                    *
  **********************************************************************************************************************/
 
-#define               _TMR_INIT( _state ) { { 0, 0, 0, 0, 0 }, _state, 0, 0, 0 }
+#if OS_TMR_TASK
+#define               _TMR_ISR_INIT , 0
+#else
+#define               _TMR_ISR_INIT
+#endif
+
+#if OS_TIME64
+#define               _TMR_HOPS_INIT , 0
+#else
+#define               _TMR_HOPS_INIT
+#endif
+
+#define               _TMR_INIT( _state ) { _OBJ_INIT(), _state, 0, 0, 0, 0 _TMR_ISR_INIT _TMR_HOPS_INIT }
 
 /**********************************************************************************************************************
  *                                                                                                                    *
@@ -358,6 +377,28 @@ void tmr_kill( tmr_t *tmr );
 
 void tmr_delete( tmr_t *tmr );
 
+#if OS_TMR_CACHE
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : tmr_cacheStat                                                                                  *
+ *                                                                                                                    *
+ * Description       : get hit / miss counters of the cache of timer objects                                          *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   hit             : pointer to store the number of objects allocated from the cache (can be null)                  *
+ *   miss            : pointer to store the number of objects allocated from the system heap (can be null)            *
+ *                                                                                                                    *
+ * Return            : none                                                                                           *
+ *                                                                                                                    *
+ * Note              : available if OS_TMR_CACHE > 0                                                                  *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+void tmr_cacheStat( unsigned *hit, unsigned *miss );
+
+#endif
+
 /**********************************************************************************************************************
  *                                                                                                                    *
  * Name              : tmr_startUntil                                                                                 *
@@ -376,6 +417,32 @@ void tmr_delete( tmr_t *tmr );
 
 void tmr_startUntil( tmr_t *tmr, uint32_t time );
 
+#if OS_TIME64
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : tmr_startUntil64                                                                               *
+ *                                                                                                                    *
+ * Description       : start/restart one-shot timer until given timepoint and then launch the callback procedure      *
+ *                     timepoints farther than the range of the system counter are counted down in half periods       *
+ *                     of the system counter, without launching the callback procedure                                *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   tmr             : pointer to timer object                                                                        *
+ *   time            : 64-bit timepoint value (sys_time64)                                                            *
+ *                     if the timepoint has already passed, the timer expires immediately                             *
+ *                                                                                                                    *
+ * Return            : none                                                                                           *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                     available if OS_TIME64 > 0                                                                     *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+void tmr_startUntil64( tmr_t *tmr, uint64_t time );
+
+#endif
+
 /**********************************************************************************************************************
  *                                                                                                                    *
  * Name              : tmr_start                                                                                      *
@@ -400,6 +467,36 @@ void tmr_startUntil( tmr_t *tmr, uint32_t time );
 
 void tmr_start( tmr_t *tmr, uint32_t delay, uint32_t period );
 
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : tmr_startSlack                                                                                 *
+ *                                                                                                                    *
+ * Description       : start/restart periodic timer for given duration of time and then launch the callback procedure *
+ *                     do this periodically if period > 0                                                             *
+ *                     each countdown can be extended by at most given slack, the expiration time is aligned,         *
+ *                     so that the timers and tasks with overlapping windows expire in a single pass of the timers    *
+ *                     queue handler                                                                                  *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   tmr             : pointer to timer object                                                                        *
+ *   delay           : duration of time (maximum number of ticks to countdown) for first expiration                   *
+ *                     IMMEDIATE: don't countdown                                                                     *
+ *                     INFINITE:  countdown indefinitly                                                               *
+ *   period          : duration of time (maximum number of ticks to countdown) for all next expirations               *
+ *                     IMMEDIATE: don't countdown                                                                     *
+ *                     INFINITE:  countdown indefinitly                                                               *
+ *   slack           : maximum number of ticks each countdown can be extended by                                      *
+ *                     0: the same as tmr_start                                                                       *
+ *                                                                                                                    *
+ * Return            : none                                                                                           *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                     next expirations of periodic timer are counted from the previous (extended) one                *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+void tmr_startSlack( tmr_t *tmr, uint32_t delay, uint32_t period, uint32_t slack );
+
 /**********************************************************************************************************************
  *                                                                                                                    *
  * Name              : tmr_startFor                                                                                   *
@@ -487,6 +584,27 @@ void tmr_startFrom( tmr_t *tmr, uint32_t delay, uint32_t period, fun_t *proc );
 __STATIC_INLINE
 void tmr_stop( tmr_t *tmr ) { tmr_start(tmr, 0, 0); }
 
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : tmr_setHandlerMode                                                                             *
+ *                                                                                                                    *
+ * Description       : select the context of execution of the timer callback procedure                                *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   tmr             : pointer to timer object                                                                        *
+ *   on              : true:  callback procedure is executed in handler mode (inside the timers queue handler)        *
+ *                     false: callback procedure is posted to the timer service task and executed in thread mode      *
+ *                            tasks waiting for the timer are resumed after the posted callback procedure             *
+ *                                                                                                                    *
+ * Return            : none                                                                                           *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                     available if OS_TMR_TASK > 0                                                                   *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+void tmr_setHandlerMode( tmr_t *tmr, bool on );
+
 /**********************************************************************************************************************
  *                                                                                                                    *
  * Name              : tmr_waitUntil                                                                                  *
@@ -508,6 +626,32 @@ void tmr_stop( tmr_t *tmr ) { tmr_start(tmr, 0, 0); }
 
 unsigned tmr_waitUntil( tmr_t *tmr, uint32_t time );
 
+#if OS_TIME64
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : tmr_waitUntil64                                                                                *
+ *                                                                                                                    *
+ * Description       : wait until given timepoint until the timer finishes countdown                                  *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   tmr             : pointer to timer object                                                                        *
+ *   time            : 64-bit timepoint value (sys_time64)                                                            *
+ *                                                                                                                    *
+ * Return                                                                                                             *
+ *   E_SUCCESS       : timer object successfully finished countdown                                                   *
+ *   E_STOPPED       : timer object was killed before the specified timeout expired                                   *
+ *   E_TIMEOUT       : timer object has not finished countdown before the specified timeout expired                   *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                     available if OS_TIME64 > 0                                                                     *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+unsigned tmr_waitUntil64( tmr_t *tmr, uint64_t time );
+
+#endif
+
 /**********************************************************************************************************************
  *                                                                                                                    *
  * Name              : tmr_waitFor                                                                                    *
@@ -608,7 +752,7 @@ unsigned tmr_takeISR( tmr_t *tmr ) { return tmr_waitFor(tmr, IMMEDIATE); }
  **********************************************************************************************************************/
 
 __STATIC_INLINE
-void tmr_flipISR( fun_t *proc ) { ((tmr_t *)WAIT.obj.next)->state = proc; }
+void tmr_flipISR( fun_t *proc ) { ThisTmr->state = proc; }
 
 /**********************************************************************************************************************
  *                                                                                                                    *
@@ -624,11 +768,12 @@ void tmr_flipISR( fun_t *proc ) { ((tmr_t *)WAIT.obj.next)->state = proc; }
  * Return            : none                                                                                           *
  *                                                                                                                    *
  * Note              : use only in timer callback procedure                                                           *
+ *                     if OS_TMR_TASK > 0, use only in callback procedure executed in handler mode                    *
  *                                                                                                                    *
  **********************************************************************************************************************/
 
 __STATIC_INLINE
-void tmr_delayISR( uint32_t delay ) { ((tmr_t *)WAIT.obj.next)->delay = delay; }
+void tmr_delayISR( uint32_t delay ) { ThisTmr->delay = delay; }
 
 #ifdef __cplusplus
 }
@@ -665,9 +810,13 @@ struct Timer : public __tmr
 
 	void kill         ( void )                                            {        tmr_kill         (this);                          }
 	void startUntil   ( uint32_t _time )                                  {        tmr_startUntil   (this, _time);                   }
+#if OS_TIME64
+	void startUntil64 ( uint64_t _time )                                  {        tmr_startUntil64 (this, _time);                   }
+#endif
 	void start        ( uint32_t _delay, uint32_t _period )               {        tmr_start        (this, _delay, _period);         }
 	void startFor     ( uint32_t _delay )                                 {        tmr_startFor     (this, _delay);                  }
 	void startPeriodic( uint32_t _period )                                {        tmr_startPeriodic(this,         _period);         }
+	void startSlack   ( uint32_t _delay, uint32_t _period, uint32_t _slack ) { tmr_startSlack   (this, _delay, _period, _slack);     }
 #if OS_FUNCTIONAL
 	void startFrom    ( uint32_t _delay, uint32_t _period, FUN_t _state ) {        _fun = _state;
 	                                                                               tmr_startFrom    (this, _delay, _period, _run);   }
@@ -675,8 +824,12 @@ struct Timer : public __tmr
 	void startFrom    ( uint32_t _delay, uint32_t _period, FUN_t _state ) {        tmr_startFrom    (this, _delay, _period, _state); }
 #endif
 	void stop         ( void )                                            {        tmr_stop         (this);                          }
+	void setHandlerMode( bool _on )                                       {        tmr_setHandlerMode(this, _on);                    }
 
 	unsigned waitUntil( uint32_t _time )                                  { return tmr_waitUntil    (this, _time);                   }
+#if OS_TIME64
+	unsigned waitUntil64( uint64_t _time )                                { return tmr_waitUntil64  (this, _time);                   }
+#endif
 	unsigned waitFor  ( uint32_t _delay )                                 { return tmr_waitFor      (this, _delay);                  }
 	unsigned wait     ( void )                                            { return tmr_wait         (this);                          }
 	unsigned take     ( void )                                            { return tmr_take         (this);                          }
@@ -685,7 +838,7 @@ struct Timer : public __tmr
 	bool     operator!( void )                                            { return __tmr::obj.id == ID_STOPPED;                      }
 #if OS_FUNCTIONAL
 	static
-	void     _run( void ) { ((Timer *) WAIT.obj.next)->_fun(); }
+	void     _run( void ) { ((Timer *) ThisTmr)->_fun(); }
 	FUN_t    _fun;
 #endif
 };
@@ -796,7 +949,7 @@ struct startTimerPeriodic : public startTimer
 namespace ThisTimer
 {
 #if OS_FUNCTIONAL
-	static inline void flipISR ( FUN_t    _state ) { ((Timer *) WAIT.obj.next)->_fun = _state;
+	static inline void flipISR ( FUN_t    _state ) { ((Timer *) ThisTmr)->_fun = _state;
 	                                                 tmr_flipISR (Timer::_run);                }
 #else
 	static inline void flipISR ( FUN_t    _state ) { tmr_flipISR (_state);                     }
@@ -63,6 +63,7 @@ struct __tsk
 	void   * guard; // object that controls the pending process
 	tsk_t  * mtree; // tree of tasks waiting for mutexes
 	mtx_t  * mlist; // list of mutexes held
+	unsigned mprio; // the highest priority imposed by the mutexes held
 
 	uint32_t slice;	// time slice
 	union  {
@@ -78,6 +79,16 @@ struct __tsk
 #if defined(__ARMCC_VERSION) && !defined(__MICROLIB)
 	char     libspace[96];
 #endif
+#if OS_WAIT_SKIP
+	tsk_t  * group; // first or last process of the priority group in the DELAYED queue
+#endif
+#if OS_TIME64
+	uint32_t hops;  // number of remaining half periods of the system counter to countdown before timeout
+#endif
+#if OS_TSK_STATS
+	uint64_t runtime;  // execution time of the task (in units of Runtime)
+	unsigned switches; // number of context switches to the task
+#endif
 };
 
 /**********************************************************************************************************************
@@ -99,12 +110,30 @@ struct __tsk
  *                                                                                                                    *
  **********************************************************************************************************************/
 
+#if OS_WAIT_SKIP
+#define               _TSK_GROUP_INIT , 0
+#else
+#define               _TSK_GROUP_INIT
+#endif
+
+#if OS_TIME64
+#define               _TSK_HOPS_INIT , 0
+#else
+#define               _TSK_HOPS_INIT
+#endif
+
+#if OS_TSK_STATS
+#define               _TSK_STATS_INIT , 0, 0
+#else
+#define               _TSK_STATS_INIT
+#endif
+
 #if defined(__ARMCC_VERSION) && !defined(__MICROLIB)
 #define               _TSK_INIT( _prio, _state, _stack, _size ) \
-                       { { 0, 0, 0, 0, 0 }, _state, 0, 0, 0, 0, _stack+ASIZE(_size), _stack, _prio, _prio, 0, 0, 0, 0, 0, { 0 }, { 0 }, { 0 } }
+                       { _OBJ_INIT(), _state, 0, 0, 0, 0, _stack+ASIZE(_size), _stack, _prio, _prio, 0, 0, 0, 0, 0, 0, { 0 }, { 0 }, { 0 } _TSK_GROUP_INIT _TSK_HOPS_INIT _TSK_STATS_INIT }
 #else
 #define               _TSK_INIT( _prio, _state, _stack, _size ) \
-                       { { 0, 0, 0, 0, 0 }, _state, 0, 0, 0, 0, _stack+ASIZE(_size), _stack, _prio, _prio, 0, 0, 0, 0, 0, { 0 }, { 0 } }
+                       { _OBJ_INIT(), _state, 0, 0, 0, 0, _stack+ASIZE(_size), _stack, _prio, _prio, 0, 0, 0, 0, 0, 0, { 0 }, { 0 } _TSK_GROUP_INIT _TSK_HOPS_INIT _TSK_STATS_INIT }
 #endif
 
 /**********************************************************************************************************************
@@ -630,6 +659,28 @@ void tsk_kill( tsk_t *tsk );
 
 void tsk_delete( tsk_t *tsk );
 
+#if OS_TSK_CACHE
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : tsk_cacheStat                                                                                  *
+ *                                                                                                                    *
+ * Description       : get hit / miss counters of the cache of task objects                                           *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   hit             : pointer to store the number of objects allocated from the cache (can be null)                  *
+ *   miss            : pointer to store the number of objects allocated from the system heap (can be null)            *
+ *                                                                                                                    *
+ * Return            : none                                                                                           *
+ *                                                                                                                    *
+ * Note              : available if OS_TSK_CACHE > 0                                                                  *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+void tsk_cacheStat( unsigned *hit, unsigned *miss );
+
+#endif
+
 /**********************************************************************************************************************
  *                                                                                                                    *
  * Name              : tsk_detach                                                                                     *
@@ -758,6 +809,31 @@ void tsk_setPrio( unsigned prio ) { tsk_prio(prio); }
 __STATIC_INLINE
 unsigned tsk_getPrio( void ) { return Current->basic; }
 
+#if OS_TSK_STATS
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : tsk_getStats                                                                                   *
+ *                                                                                                                    *
+ * Description       : get execution statistics of given task                                                         *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   tsk             : pointer to task object                                                                         *
+ *   runtime         : pointer to store the execution time of the task (can be null)                                  *
+ *                     in cpu cycles if the port provides them, in system timer ticks otherwise                       *
+ *   switches        : pointer to store the number of context switches to the task (can be null)                      *
+ *                                                                                                                    *
+ * Return            : none                                                                                           *
+ *                                                                                                                    *
+ * Note              : available if OS_TSK_STATS > 0                                                                  *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+__STATIC_INLINE
+void tsk_getStats( tsk_t *tsk, uint64_t *runtime, unsigned *switches ) { core_tsk_stat(tsk, runtime, switches); }
+
+#endif
+
 /**********************************************************************************************************************
  *                                                                                                                    *
  * Name              : tsk_waitUntil                                                                                  *
@@ -779,6 +855,32 @@ unsigned tsk_getPrio( void ) { return Current->basic; }
 
 unsigned tsk_waitUntil( unsigned flags, uint32_t time );
 
+#if OS_TIME64
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : tsk_waitUntil64                                                                                *
+ *                                                                                                                    *
+ * Description       : delay execution of current task until given timepoint and wait for flags or message            *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   flags           : all flags to wait                                                                              *
+ *                     0: wait for any flags or message                                                               *
+ *   time            : 64-bit timepoint value (sys_time64)                                                            *
+ *                                                                                                                    *
+ * Return                                                                                                             *
+ *   E_TIMEOUT       : task object was not released before the specified timeout expired                              *
+ *   'another'       : task object resumed by the direct transfer of 'another' flags or message (tsk_give)            *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                     available if OS_TIME64 > 0                                                                     *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+unsigned tsk_waitUntil64( unsigned flags, uint64_t time );
+
+#endif
+
 /**********************************************************************************************************************
  *                                                                                                                    *
  * Name              : tsk_waitFor                                                                                    *
@@ -879,6 +981,31 @@ void tsk_giveISR( tsk_t *tsk, unsigned flags ) { tsk_give(tsk, flags); }
 __STATIC_INLINE
 unsigned tsk_sleepUntil( uint32_t time ) { return tmr_waitUntil(&WAIT, time); }
 
+#if OS_TIME64
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : tsk_sleepUntil64                                                                               *
+ *                                                                                                                    *
+ * Description       : delay execution of current task until given timepoint                                          *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   time            : 64-bit timepoint value (sys_time64)                                                            *
+ *                                                                                                                    *
+ * Return                                                                                                             *
+ *   E_TIMEOUT       : task object successfully finished countdown                                                    *
+ *   E_STOPPED       : task object was resumed (tsk_resume)                                                           *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                     available if OS_TIME64 > 0                                                                     *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+__STATIC_INLINE
+unsigned tsk_sleepUntil64( uint64_t time ) { return tmr_waitUntil64(&WAIT, time); }
+
+#endif
+
 /**********************************************************************************************************************
  *                                                                                                                    *
  * Name              : tsk_sleepFor                                                                                   *
@@ -901,6 +1028,30 @@ unsigned tsk_sleepUntil( uint32_t time ) { return tmr_waitUntil(&WAIT, time); }
 __STATIC_INLINE
 unsigned tsk_sleepFor( uint32_t delay ) { return tmr_waitFor(&WAIT, delay); }
 
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : tsk_sleepForSlack                                                                              *
+ *                                                                                                                    *
+ * Description       : delay execution of current task for given duration of time extended by at most given slack     *
+ *                     the end of the delay is aligned, so that the tasks and timers with overlapping windows         *
+ *                     are resumed in a single pass of the timers queue handler                                       *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   delay           : duration of time (maximum number of ticks to delay execution of current task)                  *
+ *                     IMMEDIATE: don't delay execution of current task                                               *
+ *                     INFINITE:  delay indefinitly execution of current task                                         *
+ *   slack           : maximum number of ticks the delay can be extended by                                           *
+ *                                                                                                                    *
+ * Return                                                                                                             *
+ *   E_TIMEOUT       : task object successfully finished countdown                                                    *
+ *   E_STOPPED       : task object was resumed (tsk_resume)                                                           *
+ *                                                                                                                    *
+ * Note              : use only in thread mode                                                                        *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+unsigned tsk_sleepForSlack( uint32_t delay, uint32_t slack );
+
 /**********************************************************************************************************************
  *                                                                                                                    *
  * Name              : tsk_sleep                                                                                      *
@@ -1055,6 +1206,9 @@ struct baseTask : public __tsk
 
 	unsigned prio     ( void )            { return __tsk::basic;                 }
 	unsigned getPrio  ( void )            { return __tsk::basic;                 }
+#if OS_TSK_STATS
+	void     getStats ( uint64_t *_runtime, unsigned *_switches ) { tsk_getStats(this, _runtime, _switches); }
+#endif
 	bool     operator!( void )            { return __tsk::obj.id == ID_STOPPED;  }
 #if OS_FUNCTIONAL
 	static
@@ -1171,16 +1325,26 @@ namespace ThisTask
 	static inline void     setPrio   ( unsigned _prio )                   {        tsk_setPrio   (_prio);                 }
 	static inline unsigned getPrio   ( void )                             { return tsk_getPrio   ();                      }
 	static inline unsigned prio      ( void )                             { return tsk_getPrio   ();                      }
+#if OS_TSK_STATS
+	static inline void     getStats  ( uint64_t *_runtime, unsigned *_switches ) { tsk_getStats(Current, _runtime, _switches); }
+#endif
 
 	static inline void     kill      ( void )                             {        tsk_kill      (Current);               }
 	static inline unsigned detach    ( void )                             { return tsk_detach    (Current);               }
 	static inline void     suspend   ( void )                             {        tsk_suspend   (Current);               }
 
 	static inline unsigned waitUntil ( unsigned _flags, uint32_t _time )  { return tsk_waitUntil (_flags, _time);         }
+#if OS_TIME64
+	static inline unsigned waitUntil64( unsigned _flags, uint64_t _time )  { return tsk_waitUntil64(_flags, _time);         }
+#endif
 	static inline unsigned waitFor   ( unsigned _flags, uint32_t _delay ) { return tsk_waitFor   (_flags, _delay);        }
 	static inline unsigned wait      ( unsigned _flags )                  { return tsk_wait      (_flags);                }
 	static inline unsigned sleepUntil( uint32_t _time )                   { return tsk_sleepUntil(_time);                 }
+#if OS_TIME64
+	static inline unsigned sleepUntil64( uint64_t _time )                 { return tsk_sleepUntil64(_time);               }
+#endif
 	static inline unsigned sleepFor  ( uint32_t _delay )                  { return tsk_sleepFor  (_delay);                }
+	static inline unsigned sleepForSlack( uint32_t _delay, uint32_t _slack ) { return tsk_sleepForSlack(_delay, _slack);  }
 	static inline unsigned sleep     ( void )                             { return tsk_sleep     ();                      }
 	static inline unsigned delay     ( uint32_t _delay )                  { return tsk_delay     (_delay);                }
 }
@@ -44,3 +44,16 @@ uint32_t sys_time( void )
 }
 
 /* -------------------------------------------------------------------------- */
+
+#if OS_TIME64
+
+/* -------------------------------------------------------------------------- */
+uint64_t sys_time64( void )
+/* -------------------------------------------------------------------------- */
+{
+	return core_sys_time64();
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
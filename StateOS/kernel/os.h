@@ -45,6 +45,7 @@
 #include "inc/os_job.h" // job queue
 #include "inc/os_tmr.h" // timer
 #include "inc/os_tsk.h" // task
+#include "inc/os_pol.h" // job pool
 
 #ifdef __cplusplus
 extern "C" {
@@ -105,6 +106,31 @@ void *sys_alloc( size_t size ) { return core_sys_alloc(size); }
 __STATIC_INLINE
 void sys_free( void *ptr ) { core_sys_free(ptr); }
 
+#if OS_HEAP_SIZE
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : sys_heapStat                                                                                   *
+ *                                                                                                                    *
+ * Description       : get statistics of the system heap                                                              *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   hst             : pointer to the structure to store the statistics:                                              *
+ *                       free: total size of free blocks (in bytes)                                                   *
+ *                       largest: size of the largest block that is guaranteed to be allocated (in bytes)             *
+ *                       frag: fragmentation of free memory, 100 - largest free block * 100 / free (in percents)      *
+ *                                                                                                                    *
+ * Return            : none                                                                                           *
+ *                                                                                                                    *
+ * Note              : available if OS_HEAP_SIZE > 0                                                                  *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+__STATIC_INLINE
+void sys_heapStat( hst_t *hst ) { core_sys_stat(hst); }
+
+#endif
+
 /**********************************************************************************************************************
  *                                                                                                                    *
  * Name              : sys_lock                                                                                       *
@@ -187,6 +213,28 @@ void sys_free( void *ptr ) { core_sys_free(ptr); }
 
 uint32_t sys_time( void );
 
+#if OS_TIME64
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : sys_time64                                                                                     *
+ *                                                                                                                    *
+ * Description       : return current value of 64-bit system time (system counter extended by the number of its       *
+ *                     overflows); the lower 32 bits are equal to the value returned by sys_time                      *
+ *                                                                                                                    *
+ * Parameters        : none                                                                                           *
+ *                                                                                                                    *
+ * Return            : current value of 64-bit system time                                                            *
+ *                                                                                                                    *
+ * Note              : lock-free, can be used in thread and handler mode                                              *
+ *                     available if OS_TIME64 > 0                                                                     *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+uint64_t sys_time64( void );
+
+#endif
+
 /**********************************************************************************************************************
  *                                                                                                                    *
  * Name              : stk_assert                                                                                     *
@@ -202,6 +250,132 @@ uint32_t sys_time( void );
 #define                stk_assert() \
                        core_stk_assert()
 
+#if OS_WAKEUP_STATS
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : sys_wakeupStat                                                                                 *
+ *                                                                                                                    *
+ * Description       : return the longest masked interval of broadcast wakeup recorded for given call site            *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   idx             : index of the call site (0 .. OS_WAKEUP_STATS-1)                                                *
+ *   site            : pointer to store the call site address (can be null)                                           *
+ *                                                                                                                    *
+ * Return            : the longest masked interval in cpu cycles                                                      *
+ *   0               : call site not recorded                                                                         *
+ *                                                                                                                    *
+ * Note              : available if OS_WAKEUP_STATS > 0                                                               *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+__STATIC_INLINE
+uint32_t sys_wakeupStat( unsigned idx, void **site ) { return core_all_stat(idx, site); }
+
+#endif
+
+#if OS_LOCK_STATS
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : sys_lockStat                                                                                   *
+ *                                                                                                                    *
+ * Description       : return statistics of kernel critical sections recorded for given call site                     *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   idx             : index of the call site (0 .. OS_LOCK_STATS-1)                                                  *
+ *   site            : pointer to store the name of the function of the call site (can be null)                       *
+ *   count           : pointer to store the number of critical sections entered from the call site (can be null)      *
+ *   hist            : array of LCK_BINS counters to store the histogram of hold times (can be null)                  *
+ *                     hist[i] counts critical sections held for less than 4^(i+1) cpu cycles,                        *
+ *                     the last counter counts all the longer ones                                                    *
+ *                                                                                                                    *
+ * Return            : the longest hold time in cpu cycles                                                            *
+ *   0               : call site not recorded                                                                         *
+ *                                                                                                                    *
+ * Note              : available if OS_LOCK_STATS > 0                                                                 *
+ *                     hold times are measured on Cortex-M3 and above, only the counters are valid otherwise          *
+ *                                                                                                                    *
+ *********************************************************************************************************************/
+
+__STATIC_INLINE
+uint32_t sys_lockStat( unsigned idx, const char **site, unsigned *count, unsigned *hist ) { return core_lck_stat(idx, site, count, hist); }
+
+#endif
+
+#if OS_TMR_STATS
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : sys_tmrStat                                                                                    *
+ *                                                                                                                    *
+ * Description       : get counters of the timers queue handler                                                       *
+ *                     expired - passes is the number of timer interrupts saved by simultaneous expirations           *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   expired         : pointer to store the number of expirations of timers and delayed tasks (can be null)           *
+ *   passes          : pointer to store the number of passes of the handler with any expiration (can be null)         *
+ *                                                                                                                    *
+ * Return            : none                                                                                           *
+ *                                                                                                                    *
+ * Note              : available if OS_TMR_STATS > 0                                                                  *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+__STATIC_INLINE
+void sys_tmrStat( unsigned *expired, unsigned *passes ) { core_tmr_stat(expired, passes); }
+
+#endif
+
+#if OS_TSK_STATS > 1
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : sys_cpuStat                                                                                    *
+ *                                                                                                                    *
+ * Description       : get execution time counters of the system                                                      *
+ *                     cpu load over a window between two calls: 100% * (1 - delta of idle / delta of total)          *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   total           : pointer to store the execution time of all tasks (can be null)                                 *
+ *   idle            : pointer to store the execution time of the idle task (can be null)                             *
+ *                                                                                                                    *
+ * Return            : none                                                                                           *
+ *                                                                                                                    *
+ * Note              : execution time in cpu cycles if the port provides them, in system timer ticks otherwise        *
+ *                     available if OS_TSK_STATS > 1: otherwise cpu cycles are not counted in sleep mode              *
+ *                     and the cpu load would be overstated                                                           *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+__STATIC_INLINE
+void sys_cpuStat( uint64_t *total, uint64_t *idle ) { core_cpu_stat(total, idle); }
+
+#endif
+
+#if OS_TRACE
+
+/**********************************************************************************************************************
+ *                                                                                                                    *
+ * Name              : sys_traceBuffer                                                                                *
+ *                                                                                                                    *
+ * Description       : get the kernel event trace buffer to be dumped (e.g. to the serial port or to flash memory)    *
+ *                     the dump is decoded by the host tool: tools/ostrace.py                                         *
+ *                                                                                                                    *
+ * Parameters                                                                                                         *
+ *   size            : pointer to store the size of the trace buffer in bytes (can be null)                           *
+ *                                                                                                                    *
+ * Return            : pointer to the trace buffer                                                                    *
+ *                                                                                                                    *
+ * Note              : available if OS_TRACE > 0                                                                      *
+ *                                                                                                                    *
+ **********************************************************************************************************************/
+
+__STATIC_INLINE
+const void *sys_traceBuffer( unsigned *size ) { if (size) *size = sizeof(Trace); return &Trace; }
+
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -38,6 +38,36 @@ extern "C" {
 
 /* -------------------------------------------------------------------------- */
 
+#ifndef OS_TMR_WHEEL
+#define OS_TMR_WHEEL          0 /* timers queue is a sorted list              */
+#endif
+
+#if    (OS_TMR_WHEEL == 1) || (OS_TMR_WHEEL > 32) || (OS_TMR_WHEEL & (OS_TMR_WHEEL-1))
+#error  osconfig.h: Incorrect OS_TMR_WHEEL value! Must be a power of 2 not greater then 32.
+#endif
+
+#ifndef OS_TMR_HEAP
+#define OS_TMR_HEAP           0 /* timers queue is not a pairing heap         */
+#endif
+
+#if     OS_TMR_HEAP && OS_TMR_WHEEL
+#error  osconfig.h: OS_TMR_HEAP and OS_TMR_WHEEL cannot be used together.
+#endif
+
+#ifndef OS_TMR_TASK
+#define OS_TMR_TASK           0 /* timer callbacks run in handler mode        */
+#endif
+
+#if    (OS_TMR_TASK & (OS_TMR_TASK-1))
+#error  osconfig.h: Incorrect OS_TMR_TASK value! Must be a power of 2.
+#endif
+
+#ifndef OS_TIME64
+#define OS_TIME64             0 /* 64-bit system time is not available        */
+#endif
+
+/* -------------------------------------------------------------------------- */
+
 typedef struct __tmr tmr_t, * const tmr_id; // timer
 typedef struct __tsk tsk_t, * const tsk_id; // task
 typedef         void fun_t(); // timer/task procedure
@@ -66,8 +96,25 @@ struct __obj
 	unsigned id;    // object id: ID_STOPPED, ID_READY, ID_DELAYED, ID_TIMER, ID_IDLE
 	void   * prev;  // previous object (timer, task) in the READY queue
 	void   * next;  // next object (timer, task) in the READY queue
+#if OS_TMR_WHEEL
+	void   * wprev; // previous object (timer, task) in the timing wheel slot
+	void   * wnext; // next object (timer, task) in the timing wheel slot
+	void   * wslot; // timing wheel slot
+	uint32_t wtime; // expiration time in the timing wheel
+#elif OS_TMR_HEAP
+	void   * hprev; // parent or previous sibling object (timer, task) in the timers heap
+	void   * hnext; // next sibling object (timer, task) in the timers heap
+	void   * hchild;// first child object (timer, task) in the timers heap
+	uint32_t htime; // expiration time in the timers heap
+#endif
 };
 
+#if OS_TMR_WHEEL || OS_TMR_HEAP
+#define               _OBJ_INIT() { 0, 0, 0, 0, 0, 0, 0, 0, 0 }
+#else
+#define               _OBJ_INIT() { 0, 0, 0, 0, 0 }
+#endif
+
 /* -------------------------------------------------------------------------- */
 
 // system data
@@ -77,10 +124,17 @@ typedef struct __sys sys_t;
 struct __sys
 {
 	tsk_t  * cur;   // pointer to the current task control block
+#if OS_TMR_TASK
+	tmr_t  * tmr;   // timer whose callback procedure is executed by the timer service task
+#endif
 #if OS_TICKLESS == 0
 	volatile
 	uint32_t cnt;   // system timer counter
 #endif
+#if OS_TIME64
+	volatile
+	uint32_t half;  // number of elapsed half periods of the system timer counter
+#endif
 };
 
 /* -------------------------------------------------------------------------- */
@@ -37,7 +37,16 @@
 static
 void priv_tsk_idle( void )
 {
-#if OS_ROBIN || OS_TICKLESS == 0
+#if OS_TICKLESS == 0 && OS_IDLE_TICKLESS
+	uint32_t ticks;
+
+	__disable_irq();
+	ticks = core_sys_suspend();
+	__WFI();
+	if (ticks)
+		core_sys_resume(0);
+	__enable_irq();
+#elif OS_ROBIN || OS_TICKLESS == 0
 	__WFI();
 #endif
 }
@@ -67,6 +76,19 @@ void priv_rdy_remove( obj_t *obj )
 	prv->next = nxt;
 }
 
+/* -------------------------------------------------------------------------- */
+// return index of the least significant bit set in non-zero 'map'
+
+#if OS_PRIO_MAP || OS_TMR_WHEEL || OS_HEAP_SIZE
+
+static
+unsigned priv_map_first( uint32_t map )
+{
+	return 31 - port_clz(map & (0U - map));
+}
+
+#endif
+
 /* -------------------------------------------------------------------------- */
 // SYSTEM TIMER SERVICES
 /* -------------------------------------------------------------------------- */
@@ -75,6 +97,8 @@ tmr_t WAIT = { { .id=ID_TIMER, .prev=&WAIT, .next=&WAIT }, .delay=INFINITE }; //
 
 /* -------------------------------------------------------------------------- */
 
+#if OS_TMR_WHEEL == 0 && OS_TMR_HEAP == 0
+
 static
 void priv_tmr_insert( tmr_t *tmr, unsigned id )
 {
@@ -99,22 +123,6 @@ void priv_tmr_remove( tmr_t *tmr )
 
 /* -------------------------------------------------------------------------- */
 
-void core_tmr_insert( tmr_t *tmr, unsigned id )
-{
-	priv_tmr_insert(tmr, id);
-	port_tmr_force();
-}
-
-/* -------------------------------------------------------------------------- */
-
-void core_tmr_remove( tmr_t *tmr )
-{
-	tmr->obj.id = ID_STOPPED;
-	priv_tmr_remove(tmr);
-}
-
-/* -------------------------------------------------------------------------- */
-
 #if OS_ROBIN && OS_TICKLESS
 
 static
@@ -155,302 +163,1671 @@ bool priv_tmr_expired( tmr_t *tmr )
 
 /* -------------------------------------------------------------------------- */
 
-static
-void priv_tmr_wakeup( tmr_t *tmr, unsigned event )
-{
-	tmr->start += tmr->delay;
-	tmr->delay  = tmr->period;
-
-	if (tmr->state)
-		tmr->state();
+#endif//OS_TMR_WHEEL == 0 && OS_TMR_HEAP == 0
 
-	core_tmr_remove(tmr);
-	if (tmr->delay)
-		priv_tmr_insert(tmr, ID_TIMER);
+/* -------------------------------------------------------------------------- */
 
-	core_all_wakeup(tmr, event);
-}
+#if OS_TMR_WHEEL || OS_TMR_HEAP
 
 /* -------------------------------------------------------------------------- */
+// return time left to the expiration of timer 'tmr' measured from 'time'
+// 'time' must not be later than the current value of the system counter
+// the result is limited to ~0U (the earlier check is always safe)
 
-void core_tmr_handler( void )
+static
+uint32_t priv_tmr_remaining( tmr_t *tmr, uint32_t time )
 {
-	tmr_t *tmr;
-
-	core_stk_assert();
-
-	port_isr_lock();
+	uint32_t dly = tmr->start - time;
 
-	while (priv_tmr_expired(tmr = WAIT.obj.next))
+	if (dly <= Counter - time) // timer started after 'time'
 	{
-		if (tmr->obj.id == ID_TIMER)
-			priv_tmr_wakeup((tmr_t *)tmr, E_SUCCESS);
-
-		else      /* id == ID_DELAYED */
-			core_tsk_wakeup((tsk_t *)tmr, E_TIMEOUT);
+		dly += tmr->delay;
+		return dly < tmr->delay ? ~0U : dly;
 	}
 
-	port_isr_unlock();
+	dly = time - tmr->start;   // timer started before 'time'
+	return tmr->delay > dly ? tmr->delay - dly : 0;
 }
 
+#endif
+
 /* -------------------------------------------------------------------------- */
-// SYSTEM TASK SERVICES
+
+#if OS_TMR_WHEEL
+
 /* -------------------------------------------------------------------------- */
+// WAIT is still the list of all started timers and delayed tasks (unsorted);
+// counting timers are additionally hashed into the hierarchical timing wheel:
+// level 'lev' holds timers whose expiration time differs from the wheel time
+// at bit position (lev*WHL_BITS ... lev*WHL_BITS+WHL_BITS-1) as the highest;
+// the slots of a level are cascaded to the lower levels when the wheel time
+// reaches them; the last row holds expired timers and timers beyond the wheel
+// time overflow
 
-#ifndef MAIN_TOP
-static  stk_t     MAIN_STK[ASIZE(OS_STACK_SIZE)];
-#define MAIN_TOP (MAIN_STK+ASIZE(OS_STACK_SIZE))
-#endif
+#define WHL_BITS  ((OS_TMR_WHEEL)>16?5:(OS_TMR_WHEEL)>8?4:(OS_TMR_WHEEL)>4?3:(OS_TMR_WHEEL)>2?2:1)
+#define WHL_SIZE   (1U<<WHL_BITS)
+#define WHL_LEVELS ((32+WHL_BITS-1)/WHL_BITS)
 
-static  union  { stk_t STK[ASIZE(OS_IDLE_STACK)];
-        struct { char  stk[ABOVE(OS_IDLE_STACK)-sizeof(ctx_t)]; ctx_t ctx; } CTX; }
-        IDLE_STACK = { .CTX = { .ctx = _CTX_INIT(core_tsk_loop) } };
-#define IDLE_STK (void *)(&IDLE_STACK)
-//      IDLE_TOP (stk_t*)(&IDLE_STACK+1) // because of the SDCC
-#define IDLE_TOP (stk_t*)(&IDLE_STACK)+ASIZE(OS_IDLE_STACK)
-#define IDLE_SP  (void *)(&IDLE_STACK.CTX.ctx)
+static  struct { uint32_t time; uint32_t map[WHL_LEVELS+1]; tmr_t *slot[WHL_LEVELS+1][WHL_SIZE]; } Wheel;
 
-tsk_t MAIN = { { .id=ID_READY, .prev=&IDLE, .next=&IDLE }, .top=MAIN_TOP, .basic=OS_MAIN_PRIO, .prio=OS_MAIN_PRIO }; // main task
-tsk_t IDLE = { { .id=ID_IDLE,  .prev=&MAIN, .next=&MAIN }, .stack=IDLE_STK, .top=IDLE_TOP, .sp=IDLE_SP, .state=priv_tsk_idle }; // idle task and tasks queue
-sys_t System = { .cur=&MAIN };
+#define WHL_DUE  (&Wheel.slot[WHL_LEVELS][0]) // expired timers
+#define WHL_OVER (&Wheel.slot[WHL_LEVELS][1]) // timers beyond the wheel time overflow
 
 /* -------------------------------------------------------------------------- */
 
 static
-void priv_tsk_insert( tsk_t *tsk )
+void priv_whl_link( tmr_t *tmr, tmr_t **lst )
 {
-	tsk_t *nxt = &IDLE;
-#if OS_ROBIN && OS_TICKLESS == 0
-	tsk->slice = 0;
-#endif
-	if    (tsk->prio)
-	do     nxt = nxt->obj.next;
-	while (tsk->prio <= nxt->prio);
+	unsigned pos = lst - &Wheel.slot[0][0];
+	tmr_t  * nxt = *lst;
+	tmr_t  * prv;
 
-	priv_rdy_insert(&tsk->obj, &nxt->obj);
+	if (nxt == 0)
+	{
+		*lst = nxt = prv = tmr;
+		Wheel.map[pos/WHL_SIZE] |= 1U<<(pos%WHL_SIZE);
+	}
+	else
+	{
+		prv = nxt->obj.wprev;
+	}
+
+	tmr->obj.wslot = lst;
+	tmr->obj.wprev = prv;
+	tmr->obj.wnext = nxt;
+	nxt->obj.wprev = tmr;
+	prv->obj.wnext = tmr;
 }
 
 /* -------------------------------------------------------------------------- */
 
 static
-void priv_tsk_remove( tsk_t *tsk )
+void priv_whl_unlink( tmr_t *tmr )
 {
-	priv_rdy_remove(&tsk->obj);
+	tmr_t ** lst = tmr->obj.wslot;
+	unsigned pos = lst - &Wheel.slot[0][0];
+	tmr_t  * nxt = tmr->obj.wnext;
+	tmr_t  * prv = tmr->obj.wprev;
+
+	tmr->obj.wslot = 0;
+
+	if (nxt == tmr)
+	{
+		*lst = 0;
+		Wheel.map[pos/WHL_SIZE] &= ~(1U<<(pos%WHL_SIZE));
+	}
+	else
+	{
+		nxt->obj.wprev = prv;
+		prv->obj.wnext = nxt;
+		if (*lst == tmr)
+			*lst = nxt;
+	}
 }
 
 /* -------------------------------------------------------------------------- */
+// return the first non-empty slot and time of its processing
 
-void core_tsk_insert( tsk_t *tsk )
+static
+tmr_t **priv_whl_first( uint32_t *time )
 {
-	tsk->obj.id = ID_READY;
-	priv_tsk_insert(tsk);
-	if (tsk == IDLE.obj.next)
-		port_ctx_switch();
+	unsigned lev, idx, sft;
+
+	for (lev = 0, sft = 0; lev < WHL_LEVELS; lev++, sft += WHL_BITS)
+	{
+		if (Wheel.map[lev])
+		{
+			idx = priv_map_first(Wheel.map[lev]);
+			*time = (sft + WHL_BITS < 32 ? Wheel.time & (~0U << (sft + WHL_BITS)) : 0) | (idx << sft);
+			return &Wheel.slot[lev][idx];
+		}
+	}
+
+	*time = 0;
+	return *WHL_OVER ? WHL_OVER : 0;
 }
 
 /* -------------------------------------------------------------------------- */
+// advance the wheel time to 'now' if no timer has to be processed before
 
-void core_tsk_remove( tsk_t *tsk )
+static
+void priv_whl_sync( uint32_t now )
 {
-	tsk->obj.id = ID_STOPPED;
-	priv_tsk_remove(tsk);
-	if (tsk == Current)
-		port_ctx_switchNow();
+	uint32_t time;
+
+	if (*WHL_DUE)
+		return;
+
+	if (priv_whl_first(&time) == 0 || time - Wheel.time > now - Wheel.time)
+		Wheel.time = now;
 }
 
 /* -------------------------------------------------------------------------- */
 
-void core_ctx_init( tsk_t *tsk )
+// put timer 'tmr' into the wheel slot according to its expiration time
+
+static
+void priv_whl_put( tmr_t *tmr )
 {
-#if OS_ASSERT
-	memset(tsk->stack, 0xFF, (size_t)tsk->top - (size_t)tsk->stack);
-#endif
-	tsk->sp = (ctx_t *)tsk->top - 1;
-	port_ctx_init(tsk->sp, core_tsk_loop);
+	uint32_t dif = tmr->obj.wtime ^ Wheel.time;
+	unsigned lev;
+
+	if (dif == 0)
+	{
+		priv_whl_link(tmr, WHL_DUE);
+	}
+	else
+	if (tmr->obj.wtime < Wheel.time)
+	{
+		priv_whl_link(tmr, WHL_OVER);
+	}
+	else
+	{
+		lev = (31 - port_clz(dif)) / WHL_BITS;
+		priv_whl_link(tmr, &Wheel.slot[lev][(tmr->obj.wtime >> (lev * WHL_BITS)) & (WHL_SIZE-1)]);
+	}
 }
 
 /* -------------------------------------------------------------------------- */
 
-void core_ctx_switch( void )
+static
+void priv_whl_insert( tmr_t *tmr )
 {
-	tsk_t *cur = IDLE.obj.next;
-	tsk_t *nxt = cur->obj.next;
-	if (nxt->prio == cur->prio)
-		port_ctx_switch();
+	if (tmr->delay == INFINITE)
+		return;
+
+	tmr->obj.wtime = Wheel.time + priv_tmr_remaining(tmr, Wheel.time);
+	priv_whl_put(tmr);
 }
 
 /* -------------------------------------------------------------------------- */
 
-void core_tsk_loop( void )
+static
+void priv_whl_remove( tmr_t *tmr )
 {
-	for (;;)
+	if (tmr->obj.wslot)
+		priv_whl_unlink(tmr);
+}
+
+/* -------------------------------------------------------------------------- */
+// return the nearest expiration time of timers from the first non-empty slot
+
+#if OS_ROBIN || OS_TICKLESS == 0
+
+static
+uint32_t priv_whl_nearest( tmr_t **lst, uint32_t time )
+{
+	tmr_t  * tmr = *lst;
+	uint32_t dly;
+
+	if (lst >= &Wheel.slot[1][0])
 	{
-		port_clr_lock();
-		Current->state();
-		port_set_lock();
-		core_ctx_switch();
+		time = tmr->obj.wtime;
+		while ((tmr = tmr->obj.wnext) != *lst)
+		{
+			dly = tmr->obj.wtime - Wheel.time;
+			if (dly < time - Wheel.time)
+				time = tmr->obj.wtime;
+		}
 	}
+
+	return time;
 }
 
+#endif
+
 /* -------------------------------------------------------------------------- */
+// process the wheel up to the current time
+// return the first expired timer moved to the head of WAIT or 0 if none
 
-void core_tsk_append( tsk_t *tsk, void *obj )
+static
+tmr_t *priv_tmr_expired( void )
 {
-	tsk_t *prv;
-	tsk_t *nxt = obj;
-	tsk->guard = obj;
+	tmr_t  **lst, *tmr;
+	uint32_t time;
 
-	do prv = nxt, nxt = nxt->obj.queue;
-	while (nxt && tsk->prio <= nxt->prio);
+	for (;;)
+	{
+		port_tmr_stop();
 
-	if (nxt)
-	nxt->back = tsk;
-	tsk->back = prv;
-	tsk->obj.queue = nxt;
-	prv->obj.queue = tsk;
+		tmr = *WHL_DUE;
+		if (tmr)
+		{
+			priv_whl_unlink(tmr);
+			if (tmr->delay > Counter - tmr->start)
+			{
+				priv_whl_insert(tmr);
+				continue;
+			}
+			priv_rdy_remove(&tmr->obj);
+			priv_rdy_insert(&tmr->obj, WAIT.obj.next);
+			return tmr;
+		}
+
+		lst = priv_whl_first(&time);
+		if (lst == 0)
+			break;
+
+		if (time - Wheel.time > Counter - Wheel.time)
+		{
+	#if OS_ROBIN && OS_TICKLESS
+			time = priv_whl_nearest(lst, time);
+			port_tmr_start(time);
+			if (time - Wheel.time > Counter - Wheel.time)
+				break;
+			continue;
+	#else
+			break;
+	#endif
+		}
+
+		Wheel.time = time;
+
+		while ((tmr = *lst) != 0)
+		{
+			priv_whl_unlink(tmr);
+			priv_whl_put(tmr);
+		}
+	}
+
+	priv_whl_sync(Counter);
+
+	return 0;
 }
 
 /* -------------------------------------------------------------------------- */
 
-void core_tsk_unlink( tsk_t *tsk, unsigned event )
+static
+void priv_tmr_insert( tmr_t *tmr, unsigned id )
 {
-	tsk_t *prv = tsk->back;
-	tsk_t *nxt = tsk->obj.queue;
-	tsk->evt.event = event;
+	tmr->obj.id = id;
 
-	if (nxt)
-	nxt->back = prv;
-	prv->obj.queue = nxt;
-	tsk->obj.queue = 0; // necessary because of tsk_wait[Until|For] functions
+	priv_rdy_insert(&tmr->obj, &WAIT.obj);
+	priv_whl_sync(Counter);
+	priv_whl_insert(tmr);
 }
 
 /* -------------------------------------------------------------------------- */
 
 static
-void priv_tsk_wait( tsk_t *tsk, void *obj )
+void priv_tmr_remove( tmr_t *tmr )
 {
-	core_tsk_append((tsk_t *)tsk, obj);
-	priv_tsk_remove((tsk_t *)tsk);
-	core_tmr_insert((tmr_t *)tsk, ID_DELAYED);
+	priv_whl_remove(tmr);
+	priv_rdy_remove(&tmr->obj);
 }
 
 /* -------------------------------------------------------------------------- */
 
-unsigned core_tsk_waitUntil( void *obj, uint32_t time )
-{
-	tsk_t *cur = Current;
+#endif//OS_TMR_WHEEL
 
-	cur->start = Counter;
-	cur->delay = time - cur->start;
+/* -------------------------------------------------------------------------- */
 
-	if (cur->delay == IMMEDIATE)
-	return E_TIMEOUT;
+#if OS_TMR_HEAP
 
-	priv_tsk_wait(cur, obj);
-	port_ctx_switchLock();
+/* -------------------------------------------------------------------------- */
+// WAIT is still the list of all started timers and delayed tasks (unsorted);
+// counting timers are additionally kept in the pairing heap ordered by their
+// expiration times measured from the heap time, which never passes the
+// expiration time of the heap root
 
-	return cur->evt.event;
-}
+static  struct { uint32_t time; tmr_t *root; } Heap;
 
 /* -------------------------------------------------------------------------- */
+// meld two heaps, return the new root
 
-unsigned core_tsk_waitFor( void *obj, uint32_t delay )
+static
+tmr_t *priv_hp_meld( tmr_t *one, tmr_t *two )
 {
-	tsk_t *cur = Current;
-
-	cur->start = Counter;
-	cur->delay = delay;
+	tmr_t *tmp;
 
-	if (cur->delay == IMMEDIATE)
-	return E_TIMEOUT;
+	if (two->obj.htime - Heap.time < one->obj.htime - Heap.time)
+		tmp = one, one = two, two = tmp;
 
-	priv_tsk_wait(cur, obj);
-	port_ctx_switchLock();
+	tmp = one->obj.hchild;
+	if (tmp)
+	tmp->obj.hprev = two;
+	two->obj.hnext = tmp;
+	two->obj.hprev = one;
+	one->obj.hchild = two;
+	one->obj.hnext = 0;
+	one->obj.hprev = 0;
 
-	return cur->evt.event;
+	return one;
 }
 
 /* -------------------------------------------------------------------------- */
+// merge list of sibling heaps 'lst' in two passes, return the new root
 
-void core_tsk_suspend( tsk_t *tsk )
+static
+tmr_t *priv_hp_merge( tmr_t *lst )
 {
-	tsk->delay = INFINITE;
-
-	priv_tsk_wait(tsk, &WAIT);
-	if (tsk == Current)
-		port_ctx_switchLock();
-}
+	tmr_t *one, *two, *nxt, *tmp = 0;
 
-/* -------------------------------------------------------------------------- */
+	while ((one = lst) != 0)
+	{
+		two = one->obj.hnext;
+		if (two == 0)
+		{
+			one->obj.hprev = 0;
+			one->obj.hnext = tmp;
+			tmp = one;
+			break;
+		}
+		lst = two->obj.hnext;
+		one = priv_hp_meld(one, two);
+		one->obj.hnext = tmp;
+		tmp = one;
+	}
 
-tsk_t *core_tsk_wakeup( tsk_t *tsk, unsigned event )
-{
-	if (tsk)
+	if ((lst = tmp) != 0)
 	{
-		core_tsk_unlink((tsk_t *)tsk, event);
-		core_tmr_remove((tmr_t *)tsk);
-		core_tsk_insert((tsk_t *)tsk);
+		for (tmp = lst->obj.hnext; tmp; tmp = nxt)
+		{
+			nxt = tmp->obj.hnext;
+			lst = priv_hp_meld(lst, tmp);
+		}
+		lst->obj.hnext = 0;
 	}
 
-	return tsk;
+	return lst;
 }
 
 /* -------------------------------------------------------------------------- */
+// advance the heap time to 'now' if the heap root has not expired before
 
-tsk_t *core_one_wakeup( void *obj, unsigned event )
+static
+void priv_hp_sync( uint32_t now )
 {
-	obj_t *lst = obj;
+	tmr_t *tmr = Heap.root;
 
-	return core_tsk_wakeup(lst->queue, event);
+	if (tmr == 0 || tmr->obj.htime - Heap.time > now - Heap.time)
+		Heap.time = now;
 }
 
 /* -------------------------------------------------------------------------- */
 
-void core_all_wakeup( void *obj, unsigned event )
+static
+void priv_hp_insert( tmr_t *tmr )
 {
-	obj_t *lst = obj;
+	if (tmr->delay == INFINITE)
+		return;
+
+	tmr->obj.htime  = Heap.time + priv_tmr_remaining(tmr, Heap.time);
+	tmr->obj.hchild = 0;
+	tmr->obj.hnext  = 0;
+	tmr->obj.hprev  = 0;
 
-	while (core_tsk_wakeup(lst->queue, event));
+	Heap.root = Heap.root ? priv_hp_meld(Heap.root, tmr) : tmr;
 }
 
 /* -------------------------------------------------------------------------- */
 
-void core_tsk_prio( tsk_t *tsk, unsigned prio )
+static
+void priv_hp_remove( tmr_t *tmr )
+{
+	tmr_t *prv = tmr->obj.hprev;
+	tmr_t *nxt = tmr->obj.hnext;
+	tmr_t *sub;
+
+	if (tmr == Heap.root)
+	{
+		Heap.root = priv_hp_merge(tmr->obj.hchild);
+	}
+	else
+	if (prv) // timer is in the heap
+	{
+		if (prv->obj.hchild == tmr)
+			prv->obj.hchild = nxt;
+		else
+			prv->obj.hnext = nxt;
+		if (nxt)
+		nxt->obj.hprev = prv;
+
+		sub = priv_hp_merge(tmr->obj.hchild);
+		if (sub)
+			Heap.root = priv_hp_meld(Heap.root, sub);
+	}
+
+	tmr->obj.hchild = 0;
+	tmr->obj.hprev  = 0;
+}
+
+/* -------------------------------------------------------------------------- */
+// return the first expired timer moved to the head of WAIT or 0 if none
+
+static
+tmr_t *priv_tmr_expired( void )
+{
+	tmr_t *tmr;
+
+	for (;;)
+	{
+		port_tmr_stop();
+
+		tmr = Heap.root;
+		if (tmr == 0)
+			break;
+
+		if (tmr->obj.htime - Heap.time > Counter - Heap.time)
+		{
+	#if OS_ROBIN && OS_TICKLESS
+			port_tmr_start(tmr->obj.htime);
+			if (tmr->obj.htime - Heap.time > Counter - Heap.time)
+				break;
+			continue;
+	#else
+			break;
+	#endif
+		}
+
+		priv_hp_remove(tmr);
+		Heap.time = tmr->obj.htime;
+
+		if (tmr->delay > Counter - tmr->start)
+		{
+			priv_hp_insert(tmr);
+			continue;
+		}
+
+		priv_rdy_remove(&tmr->obj);
+		priv_rdy_insert(&tmr->obj, WAIT.obj.next);
+		return tmr;
+	}
+
+	priv_hp_sync(Counter);
+
+	return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_tmr_insert( tmr_t *tmr, unsigned id )
+{
+	tmr->obj.id = id;
+
+	priv_rdy_insert(&tmr->obj, &WAIT.obj);
+	priv_hp_sync(Counter);
+	priv_hp_insert(tmr);
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_tmr_remove( tmr_t *tmr )
+{
+	priv_hp_remove(tmr);
+	priv_rdy_remove(&tmr->obj);
+}
+
+/* -------------------------------------------------------------------------- */
+
+#endif//OS_TMR_HEAP
+
+/* -------------------------------------------------------------------------- */
+// return the number of ticks from now to the nearest expiration of timers and delayed tasks
+// INFINITE if nothing is counting
+
+#if OS_TICKLESS == 0
+
+static
+uint32_t priv_tmr_next( void )
+{
+	uint32_t time;
+#if OS_TMR_WHEEL
+	tmr_t ** lst;
+
+	if (*WHL_DUE)
+	return 0;
+
+	lst = priv_whl_first(&time);
+	if (lst == 0)
+	return INFINITE;
+
+	time = priv_whl_nearest(lst, time);
+	return time - Wheel.time > Counter - Wheel.time ? time - Counter : 0;
+#elif OS_TMR_HEAP
+	tmr_t  * tmr = Heap.root;
+
+	if (tmr == 0)
+	return INFINITE;
+
+	time = tmr->obj.htime;
+	return time - Heap.time > Counter - Heap.time ? time - Counter : 0;
+#else
+	tmr_t  * tmr = WAIT.obj.next;
+
+	if (tmr->delay == INFINITE)
+	return INFINITE;
+
+	time = Counter - tmr->start;
+	return tmr->delay > time ? tmr->delay - time : 0;
+#endif
+}
+
+#endif//OS_TICKLESS == 0
+
+/* -------------------------------------------------------------------------- */
+
+void core_tmr_insert( tmr_t *tmr, unsigned id )
+{
+	priv_tmr_insert(tmr, id);
+	port_tmr_force();
+}
+
+/* -------------------------------------------------------------------------- */
+
+void core_tmr_remove( tmr_t *tmr )
+{
+	tmr->obj.id = ID_STOPPED;
+	priv_tmr_remove(tmr);
+}
+
+/* -------------------------------------------------------------------------- */
+
+uint32_t core_tmr_slack( uint32_t start, uint32_t delay, uint32_t slack )
+{
+	uint32_t time, last, diff;
+
+	if (delay == IMMEDIATE || delay == INFINITE)
+		return delay;
+
+	if (slack > INFINITE - 1 - delay)
+		slack = INFINITE - 1 - delay;
+
+	time = start + delay;
+	last = time + slack;
+	diff = time ^ last;
+
+	// clear the bits of the last possible expiration time below the highest bit that differs from the exact one
+	if (diff)
+		last &= ~0U << (31 - port_clz(diff));
+
+	return last - start;
+}
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_TMR_STATS
+
+static struct { unsigned expired; unsigned passes; } TmrStat;
+
+/* -------------------------------------------------------------------------- */
+
+void core_tmr_stat( unsigned *expired, unsigned *passes )
+{
+	port_sys_lock();
+
+	if (expired) *expired = TmrStat.expired;
+	if (passes)  *passes  = TmrStat.passes;
+
+	port_sys_unlock();
+}
+
+#endif//OS_TMR_STATS
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_TMR_TASK
+
+static struct { tsk_t *queue; void *res; unsigned head; unsigned tail; tmr_t *timer[OS_TMR_TASK]; tmr_t *busy; } TmrPost;
+
+/* -------------------------------------------------------------------------- */
+// timer service task: execute the next posted callback procedure outside the critical section
+// the task is resumed once for all the callback procedures posted by the timers queue handler
+// tasks waiting for the timer are resumed after the callback procedure, unless the timer has been killed meanwhile
+
+static
+void priv_tmr_service( void )
+{
+	tmr_t *tmr;
+	fun_t *fun = 0;
+
+	port_sys_lock();
+
+	while (TmrPost.tail == TmrPost.head)
+		core_tsk_waitFor(&TmrPost, INFINITE);
+
+	tmr = TmrPost.timer[TmrPost.tail++ & (OS_TMR_TASK-1)];
+	if (tmr)
+		fun = tmr->state;
+	System.tmr = tmr;
+	TmrPost.busy = tmr;
+
+	port_sys_unlock();
+
+	if (fun)
+		fun();
+
+	port_sys_lock();
+
+	if (TmrPost.busy)
+		core_all_wakeup(TmrPost.busy, E_SUCCESS, __LOCK);
+	TmrPost.busy = 0;
+
+	port_sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+
+static  stk_t    TmrStack[ASIZE(OS_TMR_STACK)];
+static  tsk_t    TmrTask = { .state=priv_tmr_service, .stack=TmrStack, .top=TmrStack+ASIZE(OS_TMR_STACK), .basic=OS_TMR_PRIO, .prio=OS_TMR_PRIO };
+
+/* -------------------------------------------------------------------------- */
+
+static
+bool priv_tmr_post( tmr_t *tmr )
+{
+	if (TmrTask.obj.id == ID_STOPPED || TmrPost.head - TmrPost.tail >= OS_TMR_TASK)
+		return false;
+
+	TmrPost.timer[TmrPost.head++ & (OS_TMR_TASK-1)] = tmr;
+	if (TmrPost.queue)
+		core_one_wakeup(&TmrPost, E_SUCCESS);
+
+	return true;
+}
+
+/* -------------------------------------------------------------------------- */
+
+void core_tmr_task( void )
+{
+	if (TmrTask.obj.id == ID_STOPPED)
+	{
+		core_ctx_init(&TmrTask);
+		core_tsk_insert(&TmrTask);
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
+void core_tmr_drop( tmr_t *tmr )
+{
+	unsigned i;
+
+	for (i = TmrPost.tail; i != TmrPost.head; i++)
+		if (TmrPost.timer[i & (OS_TMR_TASK-1)] == tmr)
+			TmrPost.timer[i & (OS_TMR_TASK-1)] = 0;
+
+	if (TmrPost.busy == tmr)
+		TmrPost.busy = 0;
+}
+
+#endif//OS_TMR_TASK
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_TIME64
+
+// the countdown of the timer or the delayed task 'tmr' continues for the next half period of the system counter
+static
+void priv_tmr_hop( tmr_t *tmr, unsigned id )
+{
+	tmr->start += tmr->delay;
+	tmr->delay  = 1UL << 31;
+
+	core_tmr_remove(tmr);
+	priv_tmr_insert(tmr, id);
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_tmr_wakeup( tmr_t *tmr, unsigned event, lck_t lck )
+{
+#if OS_TMR_TASK
+	bool posted;
+#endif
+#if OS_TIME64
+	if (tmr->hops)
+	{
+		tmr->hops--;
+		priv_tmr_hop(tmr, ID_TIMER);
+		return;
+	}
+#endif
+
+	tmr->start += tmr->delay;
+	tmr->delay  = tmr->slack ? core_tmr_slack(tmr->start, tmr->period, tmr->slack) : tmr->period;
+
+#if OS_TMR_TASK
+	posted = tmr->state && !tmr->isr && priv_tmr_post(tmr);
+	if (tmr->state && !posted)
+#else
+	if (tmr->state)
+#endif
+		tmr->state();
+
+	core_tmr_remove(tmr);
+	if (tmr->delay)
+		priv_tmr_insert(tmr, ID_TIMER);
+
+#if OS_TMR_TASK
+	if (!posted) // otherwise the timer service task resumes the waiting tasks after the callback procedure
+#endif
+	core_all_wakeup(tmr, event, lck);
+}
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_ISR_QUEUE
+
+static struct { unsigned head; unsigned tail; bool busy; tsk_t *task[OS_ISR_QUEUE]; } Post;
+
+/* -------------------------------------------------------------------------- */
+
+static
+bool priv_tsk_post( tsk_t *tsk )
+{
+	if (Post.busy || !port_isr_inside() || Post.head - Post.tail >= OS_ISR_QUEUE)
+		return false;
+
+	tsk->guard = 0;
+	Post.task[Post.head++ & (OS_ISR_QUEUE-1)] = tsk;
+	port_ctx_switch();
+
+	return true;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_tsk_drain( void )
+{
+	tsk_t *tsk;
+
+	while (Post.tail != Post.head)
+	{
+		tsk = Post.task[Post.tail++ & (OS_ISR_QUEUE-1)];
+		core_tmr_remove((tmr_t *)tsk);
+		core_tsk_insert(tsk);
+	}
+}
+
+#endif//OS_ISR_QUEUE
+
+/* -------------------------------------------------------------------------- */
+
+void core_tmr_handler( void )
+{
+	tmr_t *tmr;
+#if OS_TMR_STATS
+	unsigned cnt = 0;
+#endif
+
+	core_stk_assert();
+
+	port_sys_lock();
+
+#if OS_ISR_QUEUE
+	Post.busy = true;
+	priv_tsk_drain();
+#endif
+
+#if OS_TMR_WHEEL == 0 && OS_TMR_HEAP == 0
+	while (priv_tmr_expired(tmr = WAIT.obj.next))
+#else
+	while ((tmr = priv_tmr_expired()) != 0)
+#endif
+	{
+#if OS_TMR_STATS
+		cnt++;
+#endif
+		if (tmr->obj.id == ID_TIMER)
+		{
+			core_trc_put(TRC_TIMER, tmr, 0);
+			priv_tmr_wakeup((tmr_t *)tmr, E_SUCCESS, __LOCK);
+		}
+
+		else      /* id == ID_DELAYED */
+#if OS_TIME64
+		if (((tsk_t *)tmr)->hops)
+		{
+			((tsk_t *)tmr)->hops--;
+			priv_tmr_hop(tmr, ID_DELAYED);
+		}
+		else
+#endif
+			core_tsk_wakeup((tsk_t *)tmr, E_TIMEOUT);
+	}
+
+#if OS_TMR_STATS
+	if (cnt)
+	{
+		TmrStat.expired += cnt;
+		TmrStat.passes++;
+	}
+#endif
+
+#if OS_ISR_QUEUE
+	Post.busy = false;
+#endif
+
+	port_sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+// SYSTEM TASK SERVICES
+/* -------------------------------------------------------------------------- */
+
+#ifndef MAIN_TOP
+static  stk_t     MAIN_STK[ASIZE(OS_STACK_SIZE)];
+#define MAIN_TOP (MAIN_STK+ASIZE(OS_STACK_SIZE))
+#endif
+
+static  union  { stk_t STK[ASIZE(OS_IDLE_STACK)];
+        struct { char  stk[ABOVE(OS_IDLE_STACK)-sizeof(ctx_t)]; ctx_t ctx; } CTX; }
+        IDLE_STACK = { .CTX = { .ctx = _CTX_INIT(core_tsk_loop) } };
+#define IDLE_STK (void *)(&IDLE_STACK)
+//      IDLE_TOP (stk_t*)(&IDLE_STACK+1) // because of the SDCC
+#define IDLE_TOP (stk_t*)(&IDLE_STACK)+ASIZE(OS_IDLE_STACK)
+#define IDLE_SP  (void *)(&IDLE_STACK.CTX.ctx)
+
+tsk_t MAIN = { { .id=ID_READY, .prev=&IDLE, .next=&IDLE }, .top=MAIN_TOP, .basic=OS_MAIN_PRIO, .prio=OS_MAIN_PRIO }; // main task
+tsk_t IDLE = { { .id=ID_IDLE,  .prev=&MAIN, .next=&MAIN }, .stack=IDLE_STK, .top=IDLE_TOP, .sp=IDLE_SP, .state=priv_tsk_idle }; // idle task and tasks queue
+sys_t System = { .cur=&MAIN };
+
+#if OS_TRACE
+trc_t Trace = { .magic=TRC_MAGIC, .freq=RUNTIME_FREQUENCY, .limit=OS_TRACE }; // kernel event trace
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_PRIO_MAP == 0
+
+static
+void priv_tsk_insert( tsk_t *tsk )
+{
+	tsk_t *nxt = &IDLE;
+#if OS_ROBIN && OS_TICKLESS == 0
+	tsk->slice = 0;
+#endif
+	if    (tsk->prio)
+	do     nxt = nxt->obj.next;
+	while (tsk->prio <= nxt->prio);
+
+	priv_rdy_insert(&tsk->obj, &nxt->obj);
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_tsk_remove( tsk_t *tsk )
+{
+	priv_rdy_remove(&tsk->obj);
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_cur_prio( unsigned prio )
+{
+	tsk_t *tsk = Current;
+
+	tsk->prio = prio;
+	tsk = tsk->obj.next;
+	if (tsk->prio > prio)
+		port_ctx_switch();
+}
+
+/* -------------------------------------------------------------------------- */
+
+#else //OS_PRIO_MAP
+
+/* -------------------------------------------------------------------------- */
+// tasks READY queue is still the sorted list anchored at IDLE;
+// every priority level keeps a pointer to its last task and a bit in the map;
+// priorities greater than OS_PRIO_MAP-1 share the last level (linear search)
+
+#define PRIO( prio ) ((prio) < (OS_PRIO_MAP) ? (prio) : (OS_PRIO_MAP))
+#define MAIN_LEVEL     PRIO(OS_MAIN_PRIO)
+
+static  tsk_t  * ReadyTail[OS_PRIO_MAP+1] = { [MAIN_LEVEL] = &MAIN };
+static  uint32_t ReadyMap[OS_PRIO_MAP/32+1] = { [MAIN_LEVEL/32] = 1U<<(MAIN_LEVEL%32) };
+static  uint32_t ReadyTop = 1U<<(MAIN_LEVEL/32);
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_map_set( unsigned lev, tsk_t *tsk )
+{
+	ReadyTail[lev] = tsk;
+	ReadyMap[lev/32] |= 1U<<(lev%32);
+	ReadyTop |= 1U<<(lev/32);
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_map_clr( unsigned lev )
+{
+	ReadyTail[lev] = 0;
+	if ((ReadyMap[lev/32] &= ~(1U<<(lev%32))) == 0)
+	ReadyTop &= ~(1U<<(lev/32));
+}
+
+/* -------------------------------------------------------------------------- */
+// return the first task following all tasks with priority level above 'lev'
+
+static
+tsk_t *priv_map_below( unsigned lev )
+{
+	unsigned idx = lev/32;
+	uint32_t map = ReadyMap[idx] & ~((2U<<(lev%32))-1);
+
+	if (map == 0)
+	{
+		map = ReadyTop & ~((2U<<idx)-1);
+		if (map == 0) return IDLE.obj.next;
+		idx = priv_map_first(map);
+		map = ReadyMap[idx];
+	}
+
+	return ReadyTail[idx*32 + priv_map_first(map)]->obj.next;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_tsk_link( tsk_t *tsk, tsk_t *nxt )
+{
+	unsigned lev = PRIO(tsk->prio);
+
+	priv_rdy_insert(&tsk->obj, &nxt->obj);
+
+	if (nxt == &IDLE || PRIO(nxt->prio) != lev)
+		priv_map_set(lev, tsk);
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_tsk_insert( tsk_t *tsk )
+{
+	tsk_t  * nxt;
+	unsigned lev = PRIO(tsk->prio);
+#if OS_ROBIN && OS_TICKLESS == 0
+	tsk->slice = 0;
+#endif
+	if (tsk == &IDLE)
+		return;
+
+	if (lev < OS_PRIO_MAP)
+	{
+		nxt = ReadyTail[lev];
+		nxt = nxt ? nxt->obj.next : priv_map_below(lev);
+	}
+	else
+	{
+		nxt = IDLE.obj.next;
+		while (nxt != &IDLE && tsk->prio <= nxt->prio)
+			nxt = nxt->obj.next;
+	}
+
+	priv_tsk_link(tsk, nxt);
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_tsk_remove( tsk_t *tsk )
+{
+	tsk_t  * prv = tsk->obj.prev;
+	unsigned lev = PRIO(tsk->prio);
+
+	if (ReadyTail[lev] == tsk)
+	{
+		if (prv != &IDLE && PRIO(prv->prio) == lev)
+			ReadyTail[lev] = prv;
+		else
+			priv_map_clr(lev);
+	}
+
+	priv_rdy_remove(&tsk->obj);
+}
+
+/* -------------------------------------------------------------------------- */
+// the current task is moved to the front of its new priority level
+
+static
+void priv_cur_prio( unsigned prio )
+{
+	tsk_t  * tsk = Current;
+	tsk_t  * nxt;
+	unsigned lev = PRIO(prio);
+
+	priv_tsk_remove(tsk);
+	tsk->prio = prio;
+
+	if (lev < OS_PRIO_MAP)
+	{
+		nxt = priv_map_below(lev);
+	}
+	else
+	{
+		nxt = IDLE.obj.next;
+		while (nxt != &IDLE && tsk->prio < nxt->prio)
+			nxt = nxt->obj.next;
+	}
+
+	priv_tsk_link(tsk, nxt);
+
+	if (tsk != IDLE.obj.next)
+		port_ctx_switch();
+}
+
+/* -------------------------------------------------------------------------- */
+
+#endif//OS_PRIO_MAP
+
+/* -------------------------------------------------------------------------- */
+
+void core_tsk_insert( tsk_t *tsk )
+{
+	tsk->obj.id = ID_READY;
+	priv_tsk_insert(tsk);
+	if (tsk == IDLE.obj.next)
+		port_ctx_switch();
+}
+
+/* -------------------------------------------------------------------------- */
+
+void core_tsk_remove( tsk_t *tsk )
+{
+	tsk->obj.id = ID_STOPPED;
+	priv_tsk_remove(tsk);
+	if (tsk == Current)
+	{
+	#if OS_LOCK_STATS
+		core_lck_leave();
+	#endif
+		port_ctx_switchNow();
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
+void core_ctx_init( tsk_t *tsk )
+{
+#if OS_ASSERT
+	memset(tsk->stack, 0xFF, (size_t)tsk->top - (size_t)tsk->stack);
+#endif
+	tsk->sp = (ctx_t *)tsk->top - 1;
+	port_ctx_init(tsk->sp, core_tsk_loop);
+}
+
+/* -------------------------------------------------------------------------- */
+
+void core_ctx_switch( void )
+{
+	tsk_t *cur = IDLE.obj.next;
+	tsk_t *nxt = cur->obj.next;
+	if (nxt->prio == cur->prio)
+		port_ctx_switch();
+}
+
+/* -------------------------------------------------------------------------- */
+
+void core_tsk_loop( void )
+{
+	for (;;)
+	{
+		port_clr_lock();
+		Current->state();
+		port_set_lock();
+		core_ctx_switch();
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
+void core_tsk_mprio( tsk_t *tsk )
+{
+	mtx_t  * mtx;
+	unsigned prio = 0;
+
+	for (mtx = tsk->mlist; mtx; mtx = mtx->list)
+		if (prio < mtx->top)
+			prio = mtx->top;
+
+	tsk->mprio = prio;
+}
+
+/* -------------------------------------------------------------------------- */
+// update the priority of the first task waiting for the mutex with priority inheritance
+// ('tsk->mtree' is set only for tasks waiting for such mutexes)
+// and the highest priority imposed on the owner of the mutex
+
+static inline
+void priv_mtx_top( tsk_t *tsk )
+{
+	mtx_t  * mtx = tsk->guard;
+	tsk_t  * own;
+	unsigned top;
+
+	if (tsk->mtree)
+	{
+		top = mtx->top;
+		mtx->top = mtx->queue ? mtx->queue->prio : 0;
+		own = mtx->owner;
+		if (own)
+		{
+			if (own->mprio < mtx->top)
+				own->mprio = mtx->top;
+			else
+			if (own->mprio == top && top > mtx->top)
+				core_tsk_mprio(own);
+		}
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_WAIT_SKIP == 0
+
+void core_tsk_append( tsk_t *tsk, void *obj )
+{
+	tsk_t *prv;
+	tsk_t *nxt = obj;
+	tsk->guard = obj;
+
+	do prv = nxt, nxt = nxt->obj.queue;
+	while (nxt && tsk->prio <= nxt->prio);
+
+	if (nxt)
+	nxt->back = tsk;
+	tsk->back = prv;
+	tsk->obj.queue = nxt;
+	prv->obj.queue = tsk;
+
+	priv_mtx_top(tsk);
+}
+
+/* -------------------------------------------------------------------------- */
+
+void core_tsk_unlink( tsk_t *tsk, unsigned event )
+{
+	tsk_t *prv = tsk->back;
+	tsk_t *nxt = tsk->obj.queue;
+	tsk->evt.event = event;
+
+	if (nxt)
+	nxt->back = prv;
+	prv->obj.queue = nxt;
+	tsk->obj.queue = 0; // necessary because of tsk_wait[Until|For] functions
+
+	priv_mtx_top(tsk);
+}
+
+/* -------------------------------------------------------------------------- */
+
+#else //OS_WAIT_SKIP
+
+/* -------------------------------------------------------------------------- */
+// object DELAYED queue is still the sorted list;
+// tasks with the same priority form a group, the first and the last task of the group point to each other;
+// the search jumps from group to group, so appending costs one step per distinct priority of waiting tasks
+
+void core_tsk_append( tsk_t *tsk, void *obj )
+{
+	tsk_t *prv = obj;
+	tsk_t *nxt = prv->obj.queue;
+	tsk->guard = obj;
+
+	while (nxt && tsk->prio <= nxt->prio)
+		prv = nxt->group, nxt = prv->obj.queue;
+
+	if (prv != obj && prv->prio == tsk->prio)
+	{
+		tsk->group = prv->group;
+		tsk->group->group = tsk;
+	}
+	else
+	{
+		tsk->group = tsk;
+	}
+
+	if (nxt)
+	nxt->back = tsk;
+	tsk->back = prv;
+	tsk->obj.queue = nxt;
+	prv->obj.queue = tsk;
+
+	priv_mtx_top(tsk);
+}
+
+/* -------------------------------------------------------------------------- */
+
+void core_tsk_unlink( tsk_t *tsk, unsigned event )
+{
+	tsk_t *prv = tsk->back;
+	tsk_t *nxt = tsk->obj.queue;
+	tsk_t *grp = tsk->group;
+	tsk->evt.event = event;
+
+	if (grp != tsk)
+	{
+		if (prv == tsk->guard || prv->prio != tsk->prio)
+		{
+			nxt->group = grp;   // the first task of the group
+			grp->group = nxt;
+		}
+		else
+		if (nxt == 0 || nxt->prio != tsk->prio)
+		{
+			prv->group = grp;   // the last task of the group
+			grp->group = prv;
+		}
+	}
+
+	if (nxt)
+	nxt->back = prv;
+	prv->obj.queue = nxt;
+	tsk->obj.queue = 0; // necessary because of tsk_wait[Until|For] functions
+
+	priv_mtx_top(tsk);
+}
+
+/* -------------------------------------------------------------------------- */
+
+#endif//OS_WAIT_SKIP
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_tsk_wait( tsk_t *tsk, void *obj )
+{
+	core_tsk_append((tsk_t *)tsk, obj);
+	priv_tsk_remove((tsk_t *)tsk);
+#if OS_TIME64
+	tsk->hops = 0;
+#endif
+	core_tmr_insert((tmr_t *)tsk, ID_DELAYED);
+}
+
+/* -------------------------------------------------------------------------- */
+
+// the kernel is unlocked for the time the current task is blocked, the profiled critical section is split
+static
+void priv_ctx_switchLock( void )
+{
+#if OS_LOCK_STATS
+	const char *site = core_lck_leave();
+	port_ctx_switchLock();
+	core_lck_enter(site);
+#else
+	port_ctx_switchLock();
+#endif
+}
+
+/* -------------------------------------------------------------------------- */
+
+unsigned core_tsk_waitUntil( void *obj, uint32_t time )
+{
+	tsk_t *cur = Current;
+
+	cur->start = Counter;
+	cur->delay = time - cur->start;
+
+	if (cur->delay == IMMEDIATE)
+	return E_TIMEOUT;
+
+	core_trc_put(TRC_WAIT, obj, cur->delay);
+	priv_tsk_wait(cur, obj);
+	priv_ctx_switchLock();
+
+	return cur->evt.event;
+}
+
+/* -------------------------------------------------------------------------- */
+
+unsigned core_tsk_waitFor( void *obj, uint32_t delay )
+{
+	tsk_t *cur = Current;
+
+	cur->start = Counter;
+	cur->delay = delay;
+
+	if (cur->delay == IMMEDIATE)
+	return E_TIMEOUT;
+
+	core_trc_put(TRC_WAIT, obj, cur->delay);
+	priv_tsk_wait(cur, obj);
+	priv_ctx_switchLock();
+
+	return cur->evt.event;
+}
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_TIME64
+
+uint32_t core_tsk_until64( uint64_t time )
+{
+	Current->hops = (uint32_t)(time >> 32);
+
+	return (uint32_t)time;
+}
+
+/* -------------------------------------------------------------------------- */
+
+unsigned core_tsk_waitUntil64( void *obj, uint32_t time )
+{
+	tsk_t *cur = Current;
+	uint64_t now = core_sys_time64();
+	uint64_t end = ((uint64_t)cur->hops << 32) | time;
+	uint32_t hops = 0;
+
+	if (end <= now)
+	return E_TIMEOUT;
+
+	end -= now;
+
+	cur->start = (uint32_t)now;
+	cur->delay = INFINITE;
+
+	if (end < (uint64_t)INFINITE << 31)
+	{
+		hops = (uint32_t)((end - 1) >> 31);
+		cur->delay = (uint32_t)(end - ((uint64_t)hops << 31));
+	}
+
+	core_trc_put(TRC_WAIT, obj, cur->delay);
+	priv_tsk_wait(cur, obj);
+	cur->hops = hops;
+	priv_ctx_switchLock();
+
+	return cur->evt.event;
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+void core_tsk_suspend( tsk_t *tsk )
+{
+	tsk->delay = INFINITE;
+
+	priv_tsk_wait(tsk, &WAIT);
+	if (tsk == Current)
+		priv_ctx_switchLock();
+}
+
+/* -------------------------------------------------------------------------- */
+
+tsk_t *core_tsk_wakeup( tsk_t *tsk, unsigned event )
+{
+	if (tsk)
+	{
+		core_trc_put(TRC_WAKEUP, tsk, event);
+		core_tsk_unlink((tsk_t *)tsk, event);
+#if OS_ISR_QUEUE
+		if (priv_tsk_post(tsk))
+			return tsk;
+#endif
+		core_tmr_remove((tmr_t *)tsk);
+		core_tsk_insert((tsk_t *)tsk);
+	}
+
+	return tsk;
+}
+
+/* -------------------------------------------------------------------------- */
+
+tsk_t *core_one_wakeup( void *obj, unsigned event )
+{
+	obj_t *lst = obj;
+
+	return core_tsk_wakeup(lst->queue, event);
+}
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_HANDOFF
+
+static  tsk_t  * Handoff; // task resumed by the direct handoff
+
+/* -------------------------------------------------------------------------- */
+// the task outranks all tasks in the READY queue, so it is inserted at the head of the queue after one comparison;
+// the tasks queue handler switches to the task directly
+
+tsk_t *core_one_handoff( void *obj, unsigned event )
+{
+	obj_t *lst = obj;
+	tsk_t *tsk = lst->queue;
+	tsk_t *nxt = IDLE.obj.next;
+
+	if (tsk == 0 || tsk->prio <= nxt->prio || port_isr_inside())
+		return core_tsk_wakeup(tsk, event);
+
+	core_trc_put(TRC_WAKEUP, tsk, event);
+	core_tsk_unlink(tsk, event);
+	core_tmr_remove((tmr_t *)tsk);
+	core_tsk_insert(tsk);
+	Handoff = tsk;
+
+	return tsk;
+}
+
+#endif//OS_HANDOFF
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_WAKEUP_STATS
+
+static struct { void *site; uint32_t time; } WakeupStat[OS_WAKEUP_STATS];
+
+static
+void priv_all_stat( void *site, uint32_t time )
+{
+	unsigned i;
+
+	for (i = 0; i < OS_WAKEUP_STATS; i++)
+	{
+		if (WakeupStat[i].site == 0)
+			WakeupStat[i].site = site;
+		if (WakeupStat[i].site == site)
+		{
+			if (WakeupStat[i].time < time)
+				WakeupStat[i].time = time;
+			break;
+		}
+	}
+}
+
+uint32_t core_all_stat( unsigned idx, void **site )
+{
+	if (idx >= OS_WAKEUP_STATS)
+		return 0;
+
+	if (site)
+		*site = WakeupStat[idx].site;
+
+	return WakeupStat[idx].time;
+}
+
+#endif//OS_WAKEUP_STATS
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_LOCK_STATS
+
+static struct { const char *site; uint32_t start; } LockCur;
+
+static struct { const char *site; uint32_t time; unsigned count; unsigned hist[LCK_BINS]; } LockStat[OS_LOCK_STATS];
+
+static
+void priv_lck_stat( const char *site, uint32_t time )
+{
+	unsigned i, bin;
+
+	for (bin = 0; bin < LCK_BINS - 1 && (time >> (bin * 2 + 2)) != 0; bin++);
+
+	for (i = 0; i < OS_LOCK_STATS; i++)
+	{
+		if (LockStat[i].site == 0)
+			LockStat[i].site = site;
+		if (LockStat[i].site == site)
+		{
+			if (LockStat[i].time < time)
+				LockStat[i].time = time;
+			LockStat[i].count++;
+			LockStat[i].hist[bin]++;
+			break;
+		}
+	}
+}
+
+void core_lck_enter( const char *site )
+{
+	LockCur.site = site;
+	LockCur.start = port_cyc_get();
+}
+
+const char *core_lck_leave( void )
+{
+	uint32_t time = port_cyc_get() - LockCur.start;
+	const char *site = LockCur.site;
+
+	if (site)
+	{
+		priv_lck_stat(site, time);
+		LockCur.site = 0;
+	}
+
+	return site;
+}
+
+uint32_t core_lck_stat( unsigned idx, const char **site, unsigned *count, unsigned *hist )
+{
+	uint32_t time;
+	unsigned i;
+
+	if (idx >= OS_LOCK_STATS)
+		return 0;
+
+	port_sys_lock();
+
+	if (site)
+		*site = LockStat[idx].site;
+	if (count)
+		*count = LockStat[idx].count;
+	if (hist)
+		for (i = 0; i < LCK_BINS; i++)
+			hist[i] = LockStat[idx].hist[i];
+	time = LockStat[idx].time;
+
+	port_sys_unlock();
+
+	return time;
+}
+
+#endif//OS_LOCK_STATS
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_WAKEUP_CHUNK
+
+// pending interrupts are served, the profiled critical section is split
+static
+void priv_sys_flash( lck_t lck )
+{
+#if OS_LOCK_STATS
+	const char *site = core_lck_leave();
+	port_sys_flash(lck);
+	core_lck_enter(site);
+#else
+	port_sys_flash(lck);
+#endif
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+void core_all_wakeup( void *obj, unsigned event, lck_t lck )
+{
+	obj_t *lst = obj;
+#if OS_WAKEUP_CHUNK
+	unsigned cnt = 0;
+#endif
+#if OS_WAKEUP_STATS
+	void   *site = __CALLER();
+	uint32_t cyc = port_cyc_get();
+#endif
+
+	while (core_tsk_wakeup(lst->queue, event))
+	{
+#if OS_WAKEUP_CHUNK
+		if (++cnt < OS_WAKEUP_CHUNK || lst->queue == 0)
+			continue;
+		cnt = 0;
+	#if OS_WAKEUP_STATS
+		priv_all_stat(site, port_cyc_get() - cyc);
+	#endif
+		priv_sys_flash(lck);
+	#if OS_WAKEUP_STATS
+		cyc = port_cyc_get();
+	#endif
+#endif
+	}
+
+#if OS_WAKEUP_STATS
+	priv_all_stat(site, port_cyc_get() - cyc);
+#endif
+	(void) lck;
+}
+
+/* -------------------------------------------------------------------------- */
+// the highest of priority ceilings of mutexes held by the task 'tsk' and priorities of all tasks waiting for mutexes
+// with priority inheritance held by the task 'tsk' is cached in tsk->mprio
+
+static
+unsigned priv_tsk_prio( tsk_t *tsk, unsigned prio )
 {
-	mtx_t *mtx;
-	
 	if (prio < tsk->basic)
 		prio = tsk->basic;
 
-	for (mtx = tsk->mlist; mtx; mtx = mtx->list)
-		if (mtx->queue)
-			if (prio < mtx->queue->prio)
-				prio = mtx->queue->prio;
+	if (prio < tsk->mprio)
+		prio = tsk->mprio;
+
+	return prio;
+}
+
+/* -------------------------------------------------------------------------- */
+
+void core_tsk_prio( tsk_t *tsk, unsigned prio )
+{
+	prio = priv_tsk_prio(tsk, prio);
 
 	if (tsk->prio != prio)
 	{
-		tsk->prio = prio;
-
 		if (tsk == Current)
 		{
-			tsk = tsk->obj.next;
-			if (tsk->prio > prio)
-				port_ctx_switch();
+			priv_cur_prio(prio);
 		}
 		else
 		if (tsk->obj.id == ID_READY)
 		{
 			priv_tsk_remove(tsk);
+			tsk->prio = prio;
 			core_tsk_insert(tsk);
 		}
 		else
 		if (tsk->obj.id == ID_DELAYED)
 		{
 			core_tsk_unlink(tsk, 0);
+			tsk->prio = prio;
 			core_tsk_append(tsk, tsk->guard);
 			if (tsk->mtree)
 				core_tsk_prio(tsk->mtree, prio);
 		}
+		else
+		{
+			tsk->prio = prio;
+		}
 	}
 }
 
@@ -458,26 +1835,82 @@ void core_tsk_prio( tsk_t *tsk, unsigned prio )
 
 void core_cur_prio( unsigned prio )
 {
-	mtx_t *mtx;
 	tsk_t *tsk = Current;
-	
-	if (prio < tsk->basic)
-		prio = tsk->basic;
 
-	for (mtx = tsk->mlist; mtx; mtx = mtx->list)
-		if (mtx->queue)
-			if (prio < mtx->queue->prio)
-				prio = mtx->queue->prio;
+	prio = priv_tsk_prio(tsk, prio);
 
 	if (tsk->prio != prio)
-	{
-		tsk->prio = prio;
-		tsk = tsk->obj.next;
-		if (tsk->prio > prio)
-			port_ctx_switch();
-	}
+		priv_cur_prio(prio);
+}
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_TSK_STATS
+
+static struct { uint32_t last; uint64_t total; } TskStat;
+
+/* -------------------------------------------------------------------------- */
+// charge the time elapsed since the previous context switch to the current task
+
+static
+void priv_tsk_account( tsk_t *cur, tsk_t *nxt )
+{
+	uint32_t now   = Runtime;
+	uint32_t delta = now - TskStat.last;
+
+	TskStat.last   = now;
+	TskStat.total += delta;
+	cur->runtime  += delta;
+
+	if (nxt != cur)
+		nxt->switches++;
+}
+
+/* -------------------------------------------------------------------------- */
+
+void core_tsk_account( void )
+{
+	port_sys_lock();
+
+	priv_tsk_account(Current, Current);
+
+	port_sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+
+void core_tsk_stat( tsk_t *tsk, uint64_t *runtime, unsigned *switches )
+{
+	port_sys_lock();
+
+	if (runtime)  *runtime  = tsk->runtime + (tsk == Current ? (uint32_t)(Runtime - TskStat.last) : 0);
+	if (switches) *switches = tsk->switches;
+
+	port_sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_TSK_STATS > 1
+
+void core_cpu_stat( uint64_t *total, uint64_t *idle )
+{
+	uint32_t delta;
+
+	port_sys_lock();
+
+	delta = Runtime - TskStat.last;
+
+	if (total) *total = TskStat.total + delta;
+	if (idle)  *idle  = IDLE.runtime  + (Current == &IDLE ? delta : 0);
+
+	port_sys_unlock();
 }
 
+#endif
+
+#endif//OS_TSK_STATS
+
 /* -------------------------------------------------------------------------- */
 
 void *core_tsk_handler( void *sp )
@@ -490,6 +1923,9 @@ void *core_tsk_handler( void *sp )
 	core_stk_assert();
 #endif
 	port_isr_lock();
+#if OS_ISR_QUEUE
+	priv_tsk_drain();
+#endif
 	core_ctx_reset();
 
 	cur = Current;
@@ -497,6 +1933,14 @@ void *core_tsk_handler( void *sp )
 
 	nxt = IDLE.obj.next;
 
+#if OS_HANDOFF
+	if (nxt == Handoff && nxt != cur)
+	{
+		// direct handoff: the resumed task is still the first task in the READY queue, no round robin check
+		Handoff = 0;
+	}
+	else
+#endif
 #if OS_ROBIN && OS_TICKLESS == 0
 	if (cur == nxt || (nxt->slice >= OS_FREQUENCY/OS_ROBIN && (nxt->slice = 0) == 0))
 #else
@@ -508,6 +1952,13 @@ void *core_tsk_handler( void *sp )
 		nxt = IDLE.obj.next;
 	}
 
+#if OS_TSK_STATS
+	priv_tsk_account(cur, nxt);
+#endif
+
+	if (nxt != cur)
+		core_trc_put(TRC_SWITCH, nxt, nxt->prio);
+
 	Current = nxt;
 	sp = nxt->sp;
 
@@ -522,34 +1973,263 @@ void *core_tsk_handler( void *sp )
 
 #if OS_HEAP_SIZE
 
-void *core_sys_alloc( size_t size )
+/* -------------------------------------------------------------------------- */
+// two-level segregated fit (TLSF) allocator;
+// free blocks are kept in lists indexed by the most significant bit of the block size (first level)
+// and by the next HEAP_SLB bits of the block size (second level);
+// bitmaps of non-empty lists give a suitable free block in constant time
+
+#define HEAP_SLB        3  // log2 of number of second level lists
+#define HEAP_SLN      (1U<<HEAP_SLB)
+#define HEAP_LOG      (HEAP_SLB+3) // log2 of HEAP_MIN (stk_t is 8 bytes)
+#define HEAP_MIN      (HEAP_SLN*sizeof(stk_t)) // smaller blocks are kept in the first level 0
+#define HEAP_BITS    ((OS_HEAP_SIZE) < (1UL<<10) ? 10 : (OS_HEAP_SIZE) < (1UL<<12) ? 12 : \
+                      (OS_HEAP_SIZE) < (1UL<<14) ? 14 : (OS_HEAP_SIZE) < (1UL<<16) ? 16 : \
+                      (OS_HEAP_SIZE) < (1UL<<18) ? 18 : (OS_HEAP_SIZE) < (1UL<<20) ? 20 : \
+                      (OS_HEAP_SIZE) < (1UL<<22) ? 22 : (OS_HEAP_SIZE) < (1UL<<24) ? 24 : 32)
+#define HEAP_FLN      (HEAP_BITS-HEAP_LOG+1)
+
+typedef struct __blk blk_t;
+
+struct __blk
+{
+	blk_t  * prev;  // previous physical block
+	size_t   size;  // size of the block (including header), the lowest bit is set for a free block
+	blk_t  * next_free; // next block in the list of free blocks (used only by free blocks)
+	blk_t  * prev_free; // previous block in the list of free blocks (used only by free blocks)
+};
+
+#define HEAP_HDR       ABOVE(sizeof(blk_t *)+sizeof(size_t))
+#define HEAP_BLK       ABOVE(sizeof(blk_t))
+#define HEAP_NEXT( blk, size ) ((blk_t *)((char *)(blk) + (size)))
+
+static  stk_t    TlsfHeap[ASIZE(OS_HEAP_SIZE)];
+static  struct { bool ready; size_t free; uint32_t map; uint32_t sub[HEAP_FLN]; blk_t *list[HEAP_FLN][HEAP_SLN]; } Tlsf;
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_heap_index( size_t size, unsigned *fl, unsigned *sl )
+{
+	unsigned msb;
+
+	if (size < HEAP_MIN)
+	{
+		*fl = 0;
+		*sl = size / sizeof(stk_t);
+	}
+	else
+	{
+		msb = 31 - port_clz(size);
+		*fl = msb - HEAP_LOG + 1;
+		*sl = (size >> (msb - HEAP_SLB)) & (HEAP_SLN-1);
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_heap_insert( blk_t *blk, size_t size )
+{
+	unsigned fl, sl;
+	blk_t  * nxt;
+
+	blk->size = size | 1;
+	HEAP_NEXT(blk, size)->prev = blk;
+	Tlsf.free += size;
+
+	priv_heap_index(size, &fl, &sl);
+	nxt = Tlsf.list[fl][sl];
+	blk->prev_free = 0;
+	blk->next_free = nxt;
+	if (nxt)
+	nxt->prev_free = blk;
+	Tlsf.list[fl][sl] = blk;
+	Tlsf.sub[fl] |= 1U<<sl;
+	Tlsf.map |= 1U<<fl;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_heap_remove( blk_t *blk )
+{
+	unsigned fl, sl;
+	size_t   size = blk->size & ~(size_t)1;
+	blk_t  * prv = blk->prev_free;
+	blk_t  * nxt = blk->next_free;
+
+	blk->size = size;
+	Tlsf.free -= size;
+
+	priv_heap_index(size, &fl, &sl);
+	if (nxt)
+	nxt->prev_free = prv;
+	if (prv)
+	prv->next_free = nxt;
+	else
+	if ((Tlsf.list[fl][sl] = nxt) == 0)
+		if ((Tlsf.sub[fl] &= ~(1U<<sl)) == 0)
+			Tlsf.map &= ~(1U<<fl);
+}
+
+/* -------------------------------------------------------------------------- */
+// return a free block of size not less than 'size' (good fit);
+// the size is rounded up to the next list, so that any block of the found list is large enough
+
+static
+blk_t *priv_heap_find( size_t size )
+{
+	unsigned fl, sl;
+	uint32_t map;
+
+	if (size >= HEAP_MIN)
+		size += (1U << (31 - port_clz(size) - HEAP_SLB)) - 1;
+
+	priv_heap_index(size, &fl, &sl);
+	if (fl >= HEAP_FLN)
+		return 0;
+
+	map = Tlsf.sub[fl] & (~0U << sl);
+	if (map == 0)
+	{
+		map = fl + 1 < 32 ? Tlsf.map & (~0U << (fl + 1)) : 0;
+		if (map == 0)
+			return 0;
+		fl = priv_map_first(map);
+		map = Tlsf.sub[fl];
+	}
+
+	return Tlsf.list[fl][priv_map_first(map)];
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_heap_init( void )
 {
-	static  stk_t    Heap[ASIZE(OS_HEAP_SIZE)] = { 0 };
-	#define HeapEnd (Heap+ASIZE(OS_HEAP_SIZE))
+	blk_t *blk = (blk_t *)TlsfHeap;
+	blk_t *end = HEAP_NEXT(TlsfHeap, sizeof(TlsfHeap) - HEAP_HDR);
+
+	Tlsf.ready = true;
+	blk->prev = 0;
+	end->size = 0; // sentinel: used block of zero size
+	priv_heap_insert(blk, (char *)end - (char *)blk);
+}
+
+/* -------------------------------------------------------------------------- */
 
-	static
-	stk_t *heap = Heap;
-	stk_t *temp;
-	void  *base;
+void *core_sys_alloc( size_t size )
+{
+	blk_t *blk;
+	size_t need;
+	size_t rest;
 
 	assert(size);
 
-	temp = heap + ASIZE(size);
-	if (temp > HeapEnd) return 0;
+	need = ABOVE(size) + HEAP_HDR;
+	if (need < HEAP_BLK)
+		need = HEAP_BLK;
+
+	port_sys_lock();
+
+	if (!Tlsf.ready)
+		priv_heap_init();
+
+	blk = need >= size ? priv_heap_find(need) : 0;
+	if (blk)
+	{
+		priv_heap_remove(blk);
+		rest = blk->size - need;
+		if (rest >= HEAP_BLK)
+		{
+			blk->size = need;
+			HEAP_NEXT(blk, need)->prev = blk;
+			priv_heap_insert(HEAP_NEXT(blk, need), rest);
+		}
+	}
+
+	port_sys_unlock();
 
-	base = heap;
-	heap = temp;
+	if (blk == 0) return 0;
 
-	return base; // memset(base, 0, size);
+	return memset((char *)blk + HEAP_HDR, 0, blk->size - HEAP_HDR);
 }
 
 /* -------------------------------------------------------------------------- */
 
 void core_sys_free( void *ptr )
 {
-	assert(ptr == 0);
+	blk_t *blk;
+	blk_t *nxt;
+	size_t size;
+
+	if (ptr == 0)
+		return;
+
+	port_sys_lock();
+
+	blk = (blk_t *)((char *)ptr - HEAP_HDR);
+	size = blk->size;
+
+	assert((stk_t *)blk >= TlsfHeap && (stk_t *)blk < TlsfHeap + ASIZE(OS_HEAP_SIZE));
+	assert((size & 1) == 0);
+
+	nxt = HEAP_NEXT(blk, size);
+	if (nxt->size & 1)
+	{
+		priv_heap_remove(nxt);
+		size += nxt->size;
+	}
+
+	nxt = blk->prev;
+	if (nxt && (nxt->size & 1))
+	{
+		priv_heap_remove(nxt);
+		size += nxt->size;
+		blk = nxt;
+	}
+
+	priv_heap_insert(blk, size);
+
+	port_sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+
+void core_sys_stat( hst_t *hst )
+{
+	unsigned fl, sl;
+	blk_t  * blk;
+	size_t   max = 0;
+	size_t   fit = 0;
+
+	assert(hst);
+
+	port_sys_lock();
+
+	if (!Tlsf.ready)
+		priv_heap_init();
+
+	if (Tlsf.map)
+	{
+		fl = 31 - port_clz(Tlsf.map);
+		sl = 31 - port_clz(Tlsf.sub[fl]);
+		for (blk = Tlsf.list[fl][sl]; blk; blk = blk->next_free)
+			if (max < blk->size - 1)
+				max = blk->size - 1;
+		// good fit: only the lower bound of the highest non-empty list is guaranteed to be allocated
+		if (fl == 0)
+			fit = sl * sizeof(stk_t);
+		else
+			fit = (HEAP_SLN + sl) << (fl + HEAP_LOG - 1 - HEAP_SLB);
+	}
+
+	hst->free    = Tlsf.free;
+	hst->largest = fit ? fit - HEAP_HDR : 0;
+	hst->frag    = Tlsf.free ? 100 - (unsigned)((uint64_t)max * 100 / Tlsf.free) : 0;
 
-	(void) ptr;
+	port_sys_unlock();
 }
 
 /* -------------------------------------------------------------------------- */
@@ -579,11 +2259,89 @@ void core_sys_free( void *ptr )
 
 /* -------------------------------------------------------------------------- */
 
+void *core_slb_alloc( slb_t *slb, size_t size )
+{
+	void *ptr = 0;
+
+	assert(size);
+
+	if (slb == 0)
+		return core_sys_alloc(size);
+
+	port_sys_lock();
+
+	if (size <= slb->size)
+	{
+		if (slb->free)
+		{
+			ptr = slb->free;
+			slb->free = *(void **)ptr;
+		}
+		else
+		if (slb->next < slb->limit)
+		{
+			ptr = slb->next;
+			slb->next += slb->size;
+		}
+	}
+
+	if (ptr) slb->hit++; else slb->miss++;
+
+	port_sys_unlock();
+
+	if (ptr == 0) return core_sys_alloc(size);
+
+	return memset(ptr, 0, size);
+}
+
+/* -------------------------------------------------------------------------- */
+
+void core_slb_free( slb_t *slb, void *ptr )
+{
+	if (slb && (char *)ptr >= slb->base && (char *)ptr < slb->limit)
+	{
+		port_sys_lock();
+
+		*(void **)ptr = slb->free;
+		slb->free = ptr;
+
+		port_sys_unlock();
+	}
+	else
+	{
+		core_sys_free(ptr);
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
+void core_slb_stat( slb_t *slb, unsigned *hit, unsigned *miss )
+{
+	assert(slb);
+
+	port_sys_lock();
+
+	if (hit)  *hit  = slb->hit;
+	if (miss) *miss = slb->miss;
+
+	port_sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+
 #if OS_TICKLESS == 0
 
 void core_sys_tick( void )
 {
+	#if OS_TIME64
+	if ((++System.cnt << 1) == 0)
+		System.half++;
+	#else
 	System.cnt++;
+	#endif
+	#if OS_TSK_STATS
+	core_tsk_account();
+	#endif
 	#if OS_ROBIN
 	core_tmr_handler();
 	if (++System.cur->slice >= OS_FREQUENCY/OS_ROBIN)
@@ -591,6 +2349,85 @@ void core_sys_tick( void )
 	#endif
 }
 
+/* -------------------------------------------------------------------------- */
+
+static  uint32_t Suspend; // value of the system counter at the last suppression of ticks
+
+/* -------------------------------------------------------------------------- */
+
+uint32_t core_sys_suspend( void )
+{
+	tsk_t  * nxt;
+	uint32_t next;
+	uint32_t ticks = 0;
+
+	port_sys_lock();
+
+	nxt = IDLE.obj.next;
+	if (nxt == &IDLE || (nxt == Current && nxt->obj.next == &IDLE))
+	{
+		next = priv_tmr_next();
+		if (next)
+			ticks = port_tck_suspend(next - 1);
+		if (ticks && next == INFINITE)
+			ticks = INFINITE;
+		Suspend = Counter;
+	}
+
+	port_sys_unlock();
+
+	return ticks;
+}
+
+/* -------------------------------------------------------------------------- */
+
+void core_sys_skip( uint32_t ticks )
+{
+	System.cnt += ticks;
+	#if OS_TIME64
+	core_sys_wrap();
+	#endif
+}
+
+/* -------------------------------------------------------------------------- */
+
+void core_sys_resume( uint32_t ticks )
+{
+	uint32_t cnt;
+
+	port_sys_lock();
+
+	core_sys_skip(port_tck_resume());
+	cnt = Counter - Suspend;
+	if (ticks > cnt)
+		core_sys_skip(ticks - cnt);
+
+	port_sys_unlock();
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_TIME64
+
+void core_sys_wrap( void )
+{
+	System.half += (System.half ^ (Counter >> 31)) & 1;
+}
+
+/* -------------------------------------------------------------------------- */
+
+uint64_t core_sys_time64( void )
+{
+	uint32_t half = System.half;
+	uint32_t cnt  = Counter;
+
+	half += (half ^ (cnt >> 31)) & 1;
+
+	return ((uint64_t)(half >> 1) << 32) | cnt;
+}
+
 #endif
 
 /* -------------------------------------------------------------------------- */
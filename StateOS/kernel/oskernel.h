@@ -53,6 +53,136 @@
 
 /* -------------------------------------------------------------------------- */
 
+#ifndef OS_PRIO_MAP
+#define OS_PRIO_MAP           0 /* linear search in the tasks READY queue     */
+#endif
+
+#if     OS_PRIO_MAP > 1023
+#error  osconfig.h: Incorrect OS_PRIO_MAP value! Must be less then 1024.
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifndef OS_WAKEUP_CHUNK
+#define OS_WAKEUP_CHUNK       0 /* resume all waiting tasks at once           */
+#endif
+
+#ifndef OS_WAKEUP_STATS
+#define OS_WAKEUP_STATS       0 /* do not collect masked time statistics      */
+#endif
+
+#ifndef OS_WAIT_SKIP
+#define OS_WAIT_SKIP          0 /* linear search in the objects DELAYED queue */
+#endif
+
+#ifndef OS_HANDOFF
+#define OS_HANDOFF            1 /* direct handoff to the resumed task         */
+#endif
+
+#ifndef OS_ISR_QUEUE
+#define OS_ISR_QUEUE          0 /* tasks are resumed directly in handler mode */
+#endif
+
+#if    (OS_ISR_QUEUE & (OS_ISR_QUEUE-1))
+#error  osconfig.h: Incorrect OS_ISR_QUEUE value! Must be a power of 2.
+#endif
+
+#ifndef OS_IDLE_TICKLESS
+#define OS_IDLE_TICKLESS      0 /* system timer ticks also in the idle task   */
+#endif
+
+#if     OS_IDLE_TICKLESS && OS_TICKLESS
+#error  osconfig.h: OS_IDLE_TICKLESS can be used only if OS_TICKLESS == 0.
+#endif
+
+#ifndef OS_TMR_STATS
+#define OS_TMR_STATS          0 /* do not count expirations of timers         */
+#endif
+
+#ifndef OS_TSK_STATS
+#define OS_TSK_STATS          0 /* do not count execution time of tasks       */
+#endif
+
+#ifndef OS_TRACE
+#define OS_TRACE              0 /* kernel event trace is not recorded         */
+#endif
+
+#if    (OS_TRACE & (OS_TRACE-1))
+#error  osconfig.h: Incorrect OS_TRACE value! Must be a power of 2.
+#endif
+
+#ifndef OS_LOCK_STATS
+#define OS_LOCK_STATS         0 /* do not profile critical sections           */
+#endif
+
+#define LCK_BINS              8 /* number of bins of lock hold time histogram */
+
+#ifndef OS_TMR_PRIO
+#define OS_TMR_PRIO         (~0U) /* highest priority of timer service task   */
+#endif
+
+#ifndef OS_TMR_STACK
+#define OS_TMR_STACK OS_STACK_SIZE /* stack size of timer service task        */
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifndef OS_QUEUE_POW2
+#define OS_QUEUE_POW2         0 /* queues of any size                         */
+#endif
+
+#ifndef OS_MEM_LOCKFREE
+#define OS_MEM_LOCKFREE       0 /* memory pools use critical sections         */
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifndef OS_BAR_CACHE
+#define OS_BAR_CACHE          0 /* no cache of barrier objects                */
+#endif
+
+#ifndef OS_CND_CACHE
+#define OS_CND_CACHE          0 /* no cache of condition variable objects     */
+#endif
+
+#ifndef OS_EVT_CACHE
+#define OS_EVT_CACHE          0 /* no cache of event objects                  */
+#endif
+
+#ifndef OS_FLG_CACHE
+#define OS_FLG_CACHE          0 /* no cache of flag objects                   */
+#endif
+
+#ifndef OS_LST_CACHE
+#define OS_LST_CACHE          0 /* no cache of list objects                   */
+#endif
+
+#ifndef OS_MTX_CACHE
+#define OS_MTX_CACHE          0 /* no cache of mutex objects                  */
+#endif
+
+#ifndef OS_MUT_CACHE
+#define OS_MUT_CACHE          0 /* no cache of fast mutex objects             */
+#endif
+
+#ifndef OS_SEM_CACHE
+#define OS_SEM_CACHE          0 /* no cache of semaphore objects              */
+#endif
+
+#ifndef OS_SIG_CACHE
+#define OS_SIG_CACHE          0 /* no cache of signal objects                 */
+#endif
+
+#ifndef OS_TMR_CACHE
+#define OS_TMR_CACHE          0 /* no cache of timer objects                  */
+#endif
+
+#ifndef OS_TSK_CACHE
+#define OS_TSK_CACHE          0 /* no cache of task objects                   */
+#endif
+
+/* -------------------------------------------------------------------------- */
+
 #ifdef  __cplusplus
 
 #if OS_FUNCTIONAL
@@ -95,11 +225,72 @@ extern sys_t System; // system data
 #endif
 #define Current System.cur
 
+// time base of the execution time of tasks (cpu cycles if the port provides them)
+#ifndef Runtime
+#define Runtime Counter
+#define RUNTIME_FREQUENCY (OS_FREQUENCY)
+#endif
+
+// timer whose callback procedure is being executed
+#if OS_TMR_TASK
+#define ThisTmr (port_isr_inside() ? (tmr_t *)WAIT.obj.next : System.tmr)
+#else
+#define ThisTmr ((tmr_t *)WAIT.obj.next)
+#endif
+
 /* -------------------------------------------------------------------------- */
 
 #define core_stk_assert() \
         assert((Current == &MAIN) || (port_get_sp() >= Current->stack))
 
+/* -------------------------------------------------------------------------- */
+// kernel event trace: ring buffer of records, layout is decoded by the host tool (tools/ostrace.py)
+// records are put only inside the critical section, so the ring does not need any other synchronization
+
+#define TRC_MAGIC   0x43525453UL // "STRC"
+
+#define TRC_SWITCH  1U // context switch:  obj = next task,          data = its priority
+#define TRC_WAKEUP  2U // task resumed:    obj = task,               data = event
+#define TRC_WAIT    3U // task blocked:    obj = supervising object, data = delay
+#define TRC_TIMER   4U // timer expired:   obj = timer
+#define TRC_GIVE    5U // object given:    obj = object,             data = event
+#define TRC_TAKE    6U // object taken:    obj = object,             data = event
+
+#if OS_TRACE
+
+typedef struct __trc trc_t;
+
+struct __trc
+{
+	uint32_t magic; // TRC_MAGIC, to find the buffer in a memory dump
+	uint32_t freq;  // frequency of the time stamps (RUNTIME_FREQUENCY)
+	uint32_t limit; // number of records in the ring (OS_TRACE)
+	uint32_t head;  // number of records put so far, the ring holds the last 'limit' of them
+	struct {
+	uint32_t time;  // time stamp (Runtime)
+	uint32_t info;  // record type (bits 0..7) and data (bits 8..31)
+	uint32_t obj;   // address of the object
+	}        rec[OS_TRACE];
+};
+
+extern trc_t Trace;  // kernel event trace
+
+__STATIC_INLINE
+void core_trc_put( unsigned type, const void *obj, unsigned data )
+{
+	unsigned i = Trace.head++ & (OS_TRACE - 1);
+
+	Trace.rec[i].time = Runtime;
+	Trace.rec[i].info = type | (data << 8);
+	Trace.rec[i].obj  = (uint32_t)(size_t)obj;
+}
+
+#else
+
+#define core_trc_put( type, obj, data ) ((void)0)
+
+#endif
+
 /* -------------------------------------------------------------------------- */
 
 // initiating and running the system timer
@@ -107,6 +298,18 @@ extern sys_t System; // system data
 __CONSTRUCTOR
 void port_sys_init( void );
 
+#if OS_TICKLESS == 0
+
+// delay the next interrupt of the system timer by at most 'ticks' ticks (suppress the periodic interrupts)
+// return the number of suppressed ticks (limited by the system timer), 0 if the interrupt is already pending
+uint32_t port_tck_suspend( uint32_t ticks );
+
+// restore the periodic interrupts of the system timer (keeping the phase of the ticks)
+// return the number of suppressed ticks that have elapsed and have not been counted by the handler of the system timer
+uint32_t port_tck_resume( void );
+
+#endif
+
 /* -------------------------------------------------------------------------- */
 
 // init task 'tsk' for context switch
@@ -134,6 +337,61 @@ void *core_sys_alloc( size_t size );
 // system free procedure
 void core_sys_free( void *ptr );
 
+#if OS_HEAP_SIZE
+
+// system heap statistics
+
+typedef struct __hst hst_t;
+
+struct __hst
+{
+	size_t   free;    // total size of free blocks (in bytes)
+	size_t   largest; // size of the largest block that is guaranteed to be allocated (in bytes)
+	unsigned frag;    // fragmentation of free memory (in percents)
+};
+
+// get statistics of the system heap
+void core_sys_stat( hst_t *hst );
+
+#endif
+
+// slab cache of fixed-size blocks
+
+typedef struct __slb slb_t;
+
+struct __slb
+{
+	void   * free;  // list of released blocks
+	char   * next;  // first never used block
+	char   * base;  // beginning of the cache memory
+	char   * limit; // end of the cache memory
+	size_t   size;  // size of the block
+	unsigned hit;   // number of blocks allocated from the cache
+	unsigned miss;  // number of blocks allocated from the system heap
+};
+
+#define _SLB_INIT( _data ) { 0, (char *)(_data), (char *)(_data), (char *)(_data) + sizeof(_data), sizeof((_data)[0]), 0, 0 }
+
+// define pointer 'cache' to the slab cache of 'count' blocks of 'size' bytes
+#define _SLB_DEFINE( _cache, _count, _size ) \
+        static  stk_t    _cache##Slots[_count][ASIZE(_size)]; \
+        static  slb_t    _cache##Data = _SLB_INIT(_cache##Slots); \
+        static  slb_t  * const _cache = & _cache##Data
+
+// define null pointer 'cache' (no slab cache, blocks are allocated from the system heap)
+#define _SLB_EMPTY( _cache ) \
+        static  slb_t  * const _cache = 0
+
+// allocate zeroed block of 'size' bytes from the slab cache 'slb'
+// if the cache is exhausted, 'size' exceeds size of the block or 'slb' is null, allocate memory from the system heap
+void *core_slb_alloc( slb_t *slb, size_t size );
+
+// return block 'ptr' to the slab cache 'slb' or free it if it was allocated from the system heap ('slb' can be null)
+void core_slb_free( slb_t *slb, void *ptr );
+
+// get hit / miss counters of the slab cache 'slb' (pointers can be null)
+void core_slb_stat( slb_t *slb, unsigned *hit, unsigned *miss );
+
 /* -------------------------------------------------------------------------- */
 
 // add timer 'tmr' to timers READY queue with id 'id'
@@ -146,6 +404,31 @@ void core_tmr_remove( tmr_t *tmr );
 // timers queue handler procedure
 void core_tmr_handler( void );
 
+// return 'delay' extended by at most 'slack' so that the expiration time ('start' + result) is aligned
+// to the largest power of 2 possible; timers with overlapping expiration windows expire together
+// 'delay' is returned unchanged if it is equal to IMMEDIATE or INFINITE
+uint32_t core_tmr_slack( uint32_t start, uint32_t delay, uint32_t slack );
+
+#if OS_TMR_STATS
+
+// get the number of expirations of timers and delayed tasks ('expired')
+// and the number of passes of the timers queue handler with at least one expiration ('passes')
+void core_tmr_stat( unsigned *expired, unsigned *passes );
+
+#endif
+
+#if OS_TMR_TASK
+
+// start the timer service task (if it is not started yet)
+// expired timers post their callback procedures to the timer service task
+void core_tmr_task( void );
+
+// remove timer 'tmr' from the queue of callback procedures posted to the timer service task
+// tasks waiting for the timer are no longer resumed by the timer service task
+void core_tmr_drop( tmr_t *tmr );
+
+#endif
+
 /* -------------------------------------------------------------------------- */
 
 // reset stack and restart current task
@@ -160,6 +443,8 @@ void core_tsk_insert( tsk_t *tsk );
 void core_tsk_remove( tsk_t *tsk );
 
 // append task 'tsk' to object 'obj' delayed queue
+// if OS_WAIT_SKIP is set, only the first tasks of priority groups are searched
+// (one step per distinct priority of waiting tasks)
 void core_tsk_append( tsk_t *tsk, void *obj );
 
 // remove task 'tsk' from object 'obj' delayed queue
@@ -182,6 +467,19 @@ unsigned core_tsk_waitUntil( void *obj, uint32_t time );
 // return event value
 unsigned core_tsk_waitFor( void *obj, uint32_t delay );
 
+#if OS_TIME64
+
+// store the upper half of the 64-bit timepoint 'time' in the current task
+// return the lower half of the timepoint, to be passed to core_tsk_waitUntil64 as 'time'
+uint32_t core_tsk_until64( uint64_t time );
+
+// delay execution of current task until the 64-bit timepoint prepared with core_tsk_until64
+// the countdown is continued in the timers READY queue for as many half periods of the system counter as needed
+// otherwise the same as core_tsk_waitUntil
+unsigned core_tsk_waitUntil64( void *obj, uint32_t time );
+
+#endif
+
 // delay indefinitly execution of given task
 // append given task to WAIT timer delayed queue
 // remove given task from tasks READY queue
@@ -194,6 +492,9 @@ void core_tsk_suspend( tsk_t *tsk );
 // remove task 'tsk' from timers READY queue
 // add task 'tsk' to tasks READY queue
 // force context switch if priority of task 'tsk' is greater then priority of current task and kernel works in preemptive mode
+// in handler mode the task is removed from the guard object queue only and posted to the deferred queue (if OS_ISR_QUEUE > 0)
+// posted tasks are resumed by the tasks queue handler before choosing the next task
+// the operation on the guard object is never deferred, only the timers and tasks READY queues are updated later
 // return 'tsk'
 tsk_t *core_tsk_wakeup( tsk_t *tsk, unsigned event );
 
@@ -205,12 +506,58 @@ tsk_t *core_tsk_wakeup( tsk_t *tsk, unsigned event );
 // return pointer to resumed task
 tsk_t *core_one_wakeup( void *obj, unsigned event );
 
+// resume execution of first task from object 'obj' delayed queue with 'event' event value (in thread mode)
+// if the resumed task outranks all tasks in the READY queue, the tasks queue handler switches to it directly
+// otherwise (or if OS_HANDOFF == 0) the same as core_one_wakeup
+// return pointer to resumed task
+#if OS_HANDOFF
+tsk_t *core_one_handoff( void *obj, unsigned event );
+#else
+__STATIC_INLINE
+tsk_t *core_one_handoff( void *obj, unsigned event )
+{
+	return core_one_wakeup(obj, event);
+}
+#endif
+
 // resume execution of all tasks from object 'obj' delayed queue with 'event' event value
 // remove all tasks from object 'obj' delayed queue
 // remove all resumed tasks from timers READY queue
 // add all resumed tasks to tasks READY queue
 // force context switch if priority of any resumed task is greater then priority of current task and kernel works in preemptive mode
-void core_all_wakeup( void *obj, unsigned event );
+// tasks are resumed in chunks of OS_WAKEUP_CHUNK size (if OS_WAKEUP_CHUNK > 0)
+// pending interrupts are served between chunks if the critical section was entered with the 'lck' lock state equal to 0
+void core_all_wakeup( void *obj, unsigned event, lck_t lck );
+
+#if OS_WAKEUP_STATS
+
+// return the longest time (in cpu cycles) of masked interval of core_all_wakeup procedure called from call site 'idx'
+// store address of the call site in 'site' (if 'site' is not null)
+uint32_t core_all_stat( unsigned idx, void **site );
+
+#endif
+
+#if OS_LOCK_STATS
+
+// begin the profiled critical section at call site 'site' (function name)
+// the procedure is called by port_sys_lock / port_isr_lock with the kernel locked
+void core_lck_enter( const char *site );
+
+// end the profiled critical section, update statistics of its call site
+// the procedure is called by port_sys_unlock / port_isr_unlock before the kernel is unlocked
+// return the call site of the ended critical section (or null)
+const char *core_lck_leave( void );
+
+// return the longest hold time (in cpu cycles) of critical sections entered from call site 'idx'
+// store name of the function of the call site in 'site' (if 'site' is not null)
+// store number of the critical sections in 'count' (if 'count' is not null)
+// store histogram of hold times in 'hist' (LCK_BINS counters, if 'hist' is not null)
+uint32_t core_lck_stat( unsigned idx, const char **site, unsigned *count, unsigned *hist );
+
+#endif
+
+// recompute the highest priority imposed on task 'tsk' by the mutexes it holds (tsk->mprio)
+void core_tsk_mprio( tsk_t *tsk );
 
 // set task 'tsk' priority
 // force context switch if new priority of task 'tsk' is greater then priority of current task and kernel works in preemptive mode
@@ -226,11 +573,60 @@ void core_cur_prio( unsigned prio );
 // return a pointer to the stack pointer of the next READY task the highest priority
 void *core_tsk_handler( void *sp );
 
+#if OS_TSK_STATS
+
+// charge the time elapsed since the previous context switch or the previous call to the current task
+// called on each tick of the system timer (OS_TICKLESS == 0), so the charged time never exceeds the period of Runtime
+void core_tsk_account( void );
+
+// get the execution time of task 'tsk' ('runtime', in units of Runtime)
+// and the number of context switches to the task ('switches')
+void core_tsk_stat( tsk_t *tsk, uint64_t *runtime, unsigned *switches );
+
+#if OS_TSK_STATS > 1
+
+// get the execution time of all tasks ('total') and of the idle task ('idle'), in units of Runtime
+void core_cpu_stat( uint64_t *total, uint64_t *idle );
+
+#endif
+
+#endif
+
 /* -------------------------------------------------------------------------- */
 
 // internal handler of system timer
 void core_sys_tick( void );
 
+#if OS_TICKLESS == 0
+
+// suppress the periodic interrupts of the system timer until the nearest expiration of timers and delayed tasks
+// only if there is no READY task other than the current one (and the idle task)
+// return the number of suppressed ticks, INFINITE if no timer is counting
+uint32_t core_sys_suspend( void );
+
+// advance the system counter by the number of elapsed suppressed ticks 'ticks'
+// called by the handler of the system timer at the end of the long period
+void core_sys_skip( uint32_t ticks );
+
+// restore the periodic interrupts of the system timer
+// advance the system counter by the number of elapsed suppressed ticks,
+// or so that it has advanced by 'ticks' since the suppression if that is greater
+void core_sys_resume( uint32_t ticks );
+
+#endif
+
+#if OS_TIME64
+
+// update the number of elapsed half periods of the system counter
+// must be called at least once in each half period of the system counter (tick-less mode)
+void core_sys_wrap( void );
+
+// return current value of 64-bit system time
+// lock-free: the half of the system counter period not yet counted by core_sys_wrap is detected by the counter msb
+uint64_t core_sys_time64( void );
+
+#endif
+
 /* -------------------------------------------------------------------------- */
 
 #ifdef __cplusplus
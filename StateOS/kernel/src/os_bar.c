@@ -28,6 +28,12 @@
 
 #include "inc/os_bar.h"
 
+#if OS_BAR_CACHE
+_SLB_DEFINE( BarCache, OS_BAR_CACHE, sizeof(bar_t) );
+#else
+_SLB_EMPTY( BarCache );
+#endif
+
 /* -------------------------------------------------------------------------- */
 void bar_init( bar_t *bar, unsigned limit )
 /* -------------------------------------------------------------------------- */
@@ -57,7 +63,7 @@ bar_t *bar_create( unsigned limit )
 
 	port_sys_lock();
 
-	bar = core_sys_alloc(sizeof(bar_t));
+	bar = core_slb_alloc(BarCache, sizeof(bar_t));
 	bar_init(bar, limit);
 	bar->res = bar;
 
@@ -77,7 +83,7 @@ void bar_kill( bar_t *bar )
 
 	bar->count = bar->limit;
 
-	core_all_wakeup(bar, E_STOPPED);
+	core_all_wakeup(bar, E_STOPPED, __LOCK);
 
 	port_sys_unlock();
 }
@@ -89,7 +95,7 @@ void bar_delete( bar_t *bar )
 	port_sys_lock();
 
 	bar_kill(bar);
-	core_sys_free(bar->res);
+	core_slb_free(BarCache, bar->res);
 
 	port_sys_unlock();
 }
@@ -114,7 +120,7 @@ unsigned priv_bar_wait( bar_t *bar, uint32_t time, unsigned(*wait)(void*,uint32_
 	{
 		bar->count = bar->limit;
 
-		core_all_wakeup(bar, E_SUCCESS);
+		core_all_wakeup(bar, E_SUCCESS, __LOCK);
 	}
 
 	port_sys_unlock();
@@ -131,6 +137,21 @@ unsigned bar_waitUntil( bar_t *bar, uint32_t time )
 	return priv_bar_wait(bar, time, core_tsk_waitUntil);
 }
 
+/* -------------------------------------------------------------------------- */
+
+#if OS_TIME64
+
+/* -------------------------------------------------------------------------- */
+unsigned bar_waitUntil64( bar_t *bar, uint64_t time )
+/* -------------------------------------------------------------------------- */
+{
+	assert(!port_isr_inside());
+
+	return priv_bar_wait(bar, core_tsk_until64(time), core_tsk_waitUntil64);
+}
+
+#endif
+
 /* -------------------------------------------------------------------------- */
 unsigned bar_waitFor( bar_t *bar, uint32_t delay )
 /* -------------------------------------------------------------------------- */
@@ -141,3 +162,16 @@ unsigned bar_waitFor( bar_t *bar, uint32_t delay )
 }
 
 /* -------------------------------------------------------------------------- */
+
+#if OS_BAR_CACHE
+
+/* -------------------------------------------------------------------------- */
+void bar_cacheStat( unsigned *hit, unsigned *miss )
+/* -------------------------------------------------------------------------- */
+{
+	core_slb_stat(BarCache, hit, miss);
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
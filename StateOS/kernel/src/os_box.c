@@ -36,6 +36,7 @@ void box_init( box_t *box, unsigned limit, unsigned size, void *data )
 	assert(!port_isr_inside());
 	assert(box);
 	assert(limit);
+	assert(!OS_QUEUE_POW2 || (limit & (limit - 1)) == 0);
 	assert(size);
 	assert(data);
 
@@ -84,7 +85,7 @@ void box_kill( box_t *box )
 	box->first = 0;
 	box->next  = 0;
 
-	core_all_wakeup(box, E_STOPPED);
+	core_all_wakeup(box, E_STOPPED, __LOCK);
 
 	port_sys_unlock();
 }
@@ -102,31 +103,126 @@ void box_delete( box_t *box )
 }
 
 /* -------------------------------------------------------------------------- */
+// copy mail of 'size' bytes, word by word if both buffers are word aligned
+
 static
-void priv_box_get( box_t *box, void *data )
+void priv_box_copy( char *dst, const char *src, unsigned size )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned *d;
+	const unsigned *s;
+
+	if ((((size_t)dst | (size_t)src) & (sizeof(unsigned) - 1)) == 0)
+	{
+		d = (unsigned *)dst;
+		s = (const unsigned *)src;
+		for (; size >= 2 * sizeof(unsigned); size -= 2 * sizeof(unsigned)) { d[0] = s[0]; d[1] = s[1]; d += 2; s += 2; }
+		if (size >= sizeof(unsigned)) { *d++ = *s++; size -= sizeof(unsigned); }
+		dst = (char *)d;
+		src = (const char *)s;
+	}
+
+	while (size--) *dst++ = *src++;
+}
+
+/* -------------------------------------------------------------------------- */
+// return pointer to the mail slot with index 'idx'
+
+static
+char *priv_box_slot( box_t *box, unsigned idx )
 /* -------------------------------------------------------------------------- */
 {
-	unsigned i;
-	char*buf = box->data + box->size * box->first;
+#if OS_QUEUE_POW2
+	return box->data + box->size * (idx & (box->limit - 1));
+#else
+	return box->data + box->size * idx;
+#endif
+}
 
-	for (i = 0; i < box->size; i++) ((char*)data)[i] = buf[i];
+/* -------------------------------------------------------------------------- */
+// remove the first mail from the queue
 
-	box->first = (box->first + 1) % box->limit;
+static
+void priv_box_pop( box_t *box )
+/* -------------------------------------------------------------------------- */
+{
+#if OS_QUEUE_POW2
+	box->first++;
+#else
+	if (++box->first == box->limit) box->first = 0;
+#endif
 	box->count--;
 }
 
+/* -------------------------------------------------------------------------- */
+// append the next mail to the queue
+
+static
+void priv_box_push( box_t *box )
+/* -------------------------------------------------------------------------- */
+{
+#if OS_QUEUE_POW2
+	box->next++;
+#else
+	if (++box->next == box->limit) box->next = 0;
+#endif
+	box->count++;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_box_get( box_t *box, void *data )
+/* -------------------------------------------------------------------------- */
+{
+	char *buf = priv_box_slot(box, box->first);
+
+	if (box->copy)
+		box->copy(data, buf);
+	else
+		priv_box_copy(data, buf, box->size);
+
+	priv_box_pop(box);
+}
+
 /* -------------------------------------------------------------------------- */
 static
 void priv_box_put( box_t *box, void *data )
 /* -------------------------------------------------------------------------- */
 {
-	unsigned i;
-	char*buf = box->data + box->size * box->next;
+	char *buf = priv_box_slot(box, box->next);
 
-	for (i = 0; i < box->size; i++) buf[i] = ((char*)data)[i];
+	if (box->copy)
+		box->copy(buf, data);
+	else
+		priv_box_copy(buf, data, box->size);
 
-	box->next = (box->next + 1) % box->limit;
-	box->count++;
+	priv_box_push(box);
+}
+
+/* -------------------------------------------------------------------------- */
+// a mail slot has been released: resume the first task waiting to send a mail
+// the task waiting in box_reserve (null data pointer) takes the free slot by itself
+
+static
+void priv_box_fill( box_t *box )
+/* -------------------------------------------------------------------------- */
+{
+	tsk_t *tsk = core_one_handoff(box, E_SUCCESS);
+
+	if (tsk && tsk->tmp.data) priv_box_put(box, tsk->tmp.data);
+}
+
+/* -------------------------------------------------------------------------- */
+// a mail has been appended: resume the first task waiting to receive a mail
+// the task waiting in box_peek (null data pointer) leaves the mail in the queue
+
+static
+void priv_box_drain( box_t *box )
+/* -------------------------------------------------------------------------- */
+{
+	tsk_t *tsk = core_one_handoff(box, E_SUCCESS);
+
+	if (tsk && tsk->tmp.data) priv_box_get(box, tsk->tmp.data);
 }
 
 /* -------------------------------------------------------------------------- */
@@ -134,7 +230,6 @@ static
 unsigned priv_box_wait( box_t *box, void *data, uint32_t time, unsigned(*wait)(void*,uint32_t) )
 /* -------------------------------------------------------------------------- */
 {
-	tsk_t  * tsk;
 	unsigned event = E_SUCCESS;
 
 	assert(box);
@@ -151,12 +246,11 @@ unsigned priv_box_wait( box_t *box, void *data, uint32_t time, unsigned(*wait)(v
 	else
 	{
 		priv_box_get(box, data);
-
-		tsk = core_one_wakeup(box, E_SUCCESS);
-
-		if (tsk) priv_box_put(box, tsk->tmp.data);
+		priv_box_fill(box);
 	}
 
+	core_trc_put(TRC_TAKE, box, event);
+
 	port_sys_unlock();
 
 	return event;
@@ -171,6 +265,21 @@ unsigned box_waitUntil( box_t *box, void *data, uint32_t time )
 	return priv_box_wait(box, data, time, core_tsk_waitUntil);
 }
 
+/* -------------------------------------------------------------------------- */
+
+#if OS_TIME64
+
+/* -------------------------------------------------------------------------- */
+unsigned box_waitUntil64( box_t *box, void *data, uint64_t time )
+/* -------------------------------------------------------------------------- */
+{
+	assert(!port_isr_inside());
+
+	return priv_box_wait(box, data, core_tsk_until64(time), core_tsk_waitUntil64);
+}
+
+#endif
+
 /* -------------------------------------------------------------------------- */
 unsigned box_waitFor( box_t *box, void *data, uint32_t delay )
 /* -------------------------------------------------------------------------- */
@@ -185,7 +294,6 @@ static
 unsigned priv_box_send( box_t *box, void *data, uint32_t time, unsigned(*wait)(void*,uint32_t) )
 /* -------------------------------------------------------------------------- */
 {
-	tsk_t  * tsk;
 	unsigned event = E_SUCCESS;
 
 	assert(box);
@@ -202,12 +310,11 @@ unsigned priv_box_send( box_t *box, void *data, uint32_t time, unsigned(*wait)(v
 	else
 	{
 		priv_box_put(box, data);
-
-		tsk = core_one_wakeup(box, E_SUCCESS);
-
-		if (tsk) priv_box_get(box, tsk->tmp.data);
+		priv_box_drain(box);
 	}
 
+	core_trc_put(TRC_GIVE, box, event);
+
 	port_sys_unlock();
 
 	return event;
@@ -232,3 +339,175 @@ unsigned box_sendFor( box_t *box, const void *data, uint32_t delay )
 }
 
 /* -------------------------------------------------------------------------- */
+static
+unsigned priv_box_reserve( box_t *box, void **data, uint32_t time, unsigned(*wait)(void*,uint32_t) )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned event = E_SUCCESS;
+
+	assert(box);
+	assert(data);
+
+	port_sys_lock();
+
+	if (box->count >= box->limit)
+	{
+		Current->tmp.data = 0;
+
+		event = wait(box, time);
+	}
+
+	if (event == E_SUCCESS)
+		*data = priv_box_slot(box, box->next);
+
+	port_sys_unlock();
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned box_reserveUntil( box_t *box, void **data, uint32_t time )
+/* -------------------------------------------------------------------------- */
+{
+	assert(!port_isr_inside());
+
+	return priv_box_reserve(box, data, time, core_tsk_waitUntil);
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned box_reserveFor( box_t *box, void **data, uint32_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	assert(!port_isr_inside() || !delay);
+
+	return priv_box_reserve(box, data, delay, core_tsk_waitFor);
+}
+
+/* -------------------------------------------------------------------------- */
+void box_commit( box_t *box )
+/* -------------------------------------------------------------------------- */
+{
+	assert(box);
+
+	port_sys_lock();
+
+	assert(box->count < box->limit);
+
+	priv_box_push(box);
+	priv_box_drain(box);
+
+	port_sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+static
+unsigned priv_box_peek( box_t *box, void **data, uint32_t time, unsigned(*wait)(void*,uint32_t) )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned event = E_SUCCESS;
+
+	assert(box);
+	assert(data);
+
+	port_sys_lock();
+
+	if (box->count == 0)
+	{
+		Current->tmp.data = 0;
+
+		event = wait(box, time);
+	}
+
+	if (event == E_SUCCESS)
+		*data = priv_box_slot(box, box->first);
+
+	port_sys_unlock();
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned box_peekUntil( box_t *box, void **data, uint32_t time )
+/* -------------------------------------------------------------------------- */
+{
+	assert(!port_isr_inside());
+
+	return priv_box_peek(box, data, time, core_tsk_waitUntil);
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned box_peekFor( box_t *box, void **data, uint32_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	assert(!port_isr_inside() || !delay);
+
+	return priv_box_peek(box, data, delay, core_tsk_waitFor);
+}
+
+/* -------------------------------------------------------------------------- */
+void box_release( box_t *box )
+/* -------------------------------------------------------------------------- */
+{
+	assert(box);
+
+	port_sys_lock();
+
+	assert(box->count > 0);
+
+	priv_box_pop(box);
+	priv_box_fill(box);
+
+	port_sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned box_sendMany( box_t *box, const void *data, unsigned count )
+/* -------------------------------------------------------------------------- */
+{
+	const char *src = data;
+	unsigned n;
+
+	assert(box);
+	assert(data || !count);
+
+	port_sys_lock();
+
+	for (n = 0; n < count && box->count < box->limit; n++, src += box->size)
+	{
+		priv_box_put(box, (void *)src);
+
+		if (box->queue)
+			priv_box_drain(box);
+	}
+
+	port_sys_unlock();
+
+	return n;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned box_waitMany( box_t *box, void *data, unsigned count )
+/* -------------------------------------------------------------------------- */
+{
+	char *dst = data;
+	unsigned n;
+
+	assert(box);
+	assert(data || !count);
+
+	port_sys_lock();
+
+	for (n = 0; n < count && box->count > 0; n++, dst += box->size)
+	{
+		priv_box_get(box, dst);
+
+		if (box->queue)
+			priv_box_fill(box);
+	}
+
+	port_sys_unlock();
+
+	return n;
+}
+
+/* -------------------------------------------------------------------------- */
@@ -28,6 +28,12 @@
 
 #include "inc/os_cnd.h"
 
+#if OS_CND_CACHE
+_SLB_DEFINE( CndCache, OS_CND_CACHE, sizeof(cnd_t) );
+#else
+_SLB_EMPTY( CndCache );
+#endif
+
 /* -------------------------------------------------------------------------- */
 void cnd_init( cnd_t *cnd )
 /* -------------------------------------------------------------------------- */
@@ -52,7 +58,7 @@ cnd_t *cnd_create( void )
 
 	port_sys_lock();
 
-	cnd = core_sys_alloc(sizeof(cnd_t));
+	cnd = core_slb_alloc(CndCache, sizeof(cnd_t));
 	cnd_init(cnd);
 	cnd->res = cnd;
 
@@ -70,7 +76,7 @@ void cnd_kill( cnd_t *cnd )
 
 	port_sys_lock();
 
-	core_all_wakeup(cnd, E_STOPPED);
+	core_all_wakeup(cnd, E_STOPPED, __LOCK);
 
 	port_sys_unlock();
 }
@@ -82,7 +88,7 @@ void cnd_delete( cnd_t *cnd )
 	port_sys_lock();
 
 	cnd_kill(cnd);
-	core_sys_free(cnd->res);
+	core_slb_free(CndCache, cnd->res);
 
 	port_sys_unlock();
 }
@@ -117,6 +123,21 @@ unsigned cnd_waitUntil( cnd_t *cnd, mtx_t *mtx, uint32_t time )
 	return priv_cnd_wait(cnd, mtx, time, core_tsk_waitUntil);
 }
 
+/* -------------------------------------------------------------------------- */
+
+#if OS_TIME64
+
+/* -------------------------------------------------------------------------- */
+unsigned cnd_waitUntil64( cnd_t *cnd, mtx_t *mtx, uint64_t time )
+/* -------------------------------------------------------------------------- */
+{
+	assert(!port_isr_inside());
+
+	return priv_cnd_wait(cnd, mtx, core_tsk_until64(time), core_tsk_waitUntil64);
+}
+
+#endif
+
 /* -------------------------------------------------------------------------- */
 unsigned cnd_waitFor( cnd_t *cnd, mtx_t *mtx, uint32_t delay )
 /* -------------------------------------------------------------------------- */
@@ -134,10 +155,23 @@ void cnd_give( cnd_t *cnd, bool all )
 
 	port_sys_lock();
 
-	if (all) core_all_wakeup(cnd, E_SUCCESS);
+	if (all) core_all_wakeup(cnd, E_SUCCESS, __LOCK);
 	else     core_one_wakeup(cnd, E_SUCCESS);
 
 	port_sys_unlock();
 }
 
 /* -------------------------------------------------------------------------- */
+
+#if OS_CND_CACHE
+
+/* -------------------------------------------------------------------------- */
+void cnd_cacheStat( unsigned *hit, unsigned *miss )
+/* -------------------------------------------------------------------------- */
+{
+	core_slb_stat(CndCache, hit, miss);
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
@@ -28,6 +28,12 @@
 
 #include "inc/os_evt.h"
 
+#if OS_EVT_CACHE
+_SLB_DEFINE( EvtCache, OS_EVT_CACHE, sizeof(evt_t) );
+#else
+_SLB_EMPTY( EvtCache );
+#endif
+
 /* -------------------------------------------------------------------------- */
 void evt_init( evt_t *evt )
 /* -------------------------------------------------------------------------- */
@@ -52,7 +58,7 @@ evt_t *evt_create( void )
 
 	port_sys_lock();
 
-	evt = core_sys_alloc(sizeof(evt_t));
+	evt = core_slb_alloc(EvtCache, sizeof(evt_t));
 	evt_init(evt);
 	evt->res = evt;
 
@@ -70,7 +76,7 @@ void evt_kill( evt_t *evt )
 
 	port_sys_lock();
 
-	core_all_wakeup(evt, E_STOPPED);
+	core_all_wakeup(evt, E_STOPPED, __LOCK);
 
 	port_sys_unlock();
 }
@@ -82,7 +88,7 @@ void evt_delete( evt_t *evt )
 	port_sys_lock();
 
 	evt_kill(evt);
-	core_sys_free(evt->res);
+	core_slb_free(EvtCache, evt->res);
 
 	port_sys_unlock();
 }
@@ -114,6 +120,21 @@ unsigned evt_waitUntil( evt_t *evt, uint32_t time )
 	return priv_evt_wait(evt, time, core_tsk_waitUntil);
 }
 
+/* -------------------------------------------------------------------------- */
+
+#if OS_TIME64
+
+/* -------------------------------------------------------------------------- */
+unsigned evt_waitUntil64( evt_t *evt, uint64_t time )
+/* -------------------------------------------------------------------------- */
+{
+	assert(!port_isr_inside());
+
+	return priv_evt_wait(evt, core_tsk_until64(time), core_tsk_waitUntil64);
+}
+
+#endif
+
 /* -------------------------------------------------------------------------- */
 unsigned evt_waitFor( evt_t *evt, uint32_t delay )
 /* -------------------------------------------------------------------------- */
@@ -131,9 +152,22 @@ void evt_give( evt_t *evt, unsigned event )
 
 	port_sys_lock();
 
-	core_all_wakeup(evt, event);
+	core_all_wakeup(evt, event, __LOCK);
 
 	port_sys_unlock();
 }
 
 /* -------------------------------------------------------------------------- */
+
+#if OS_EVT_CACHE
+
+/* -------------------------------------------------------------------------- */
+void evt_cacheStat( unsigned *hit, unsigned *miss )
+/* -------------------------------------------------------------------------- */
+{
+	core_slb_stat(EvtCache, hit, miss);
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
@@ -29,6 +29,12 @@
 #include "inc/os_flg.h"
 #include "inc/os_tsk.h"
 
+#if OS_FLG_CACHE
+_SLB_DEFINE( FlgCache, OS_FLG_CACHE, sizeof(flg_t) );
+#else
+_SLB_EMPTY( FlgCache );
+#endif
+
 /* -------------------------------------------------------------------------- */
 void flg_init( flg_t *flg )
 /* -------------------------------------------------------------------------- */
@@ -53,7 +59,7 @@ flg_t *flg_create( void )
 
 	port_sys_lock();
 
-	flg = core_sys_alloc(sizeof(flg_t));
+	flg = core_slb_alloc(FlgCache, sizeof(flg_t));
 	flg_init(flg);
 	flg->res = flg;
 
@@ -71,7 +77,7 @@ void flg_kill( flg_t *flg )
 
 	port_sys_lock();
 
-	core_all_wakeup(flg, E_STOPPED);
+	core_all_wakeup(flg, E_STOPPED, __LOCK);
 
 	port_sys_unlock();
 }
@@ -83,7 +89,7 @@ void flg_delete( flg_t *flg )
 	port_sys_lock();
 
 	flg_kill(flg);
-	core_sys_free(flg->res);
+	core_slb_free(FlgCache, flg->res);
 
 	port_sys_unlock();
 }
@@ -123,6 +129,21 @@ unsigned flg_waitUntil( flg_t *flg, unsigned flags, unsigned mode, uint32_t time
 	return priv_flg_wait(flg, flags, mode, time, core_tsk_waitUntil);
 }
 
+/* -------------------------------------------------------------------------- */
+
+#if OS_TIME64
+
+/* -------------------------------------------------------------------------- */
+unsigned flg_waitUntil64( flg_t *flg, unsigned flags, unsigned mode, uint64_t time )
+/* -------------------------------------------------------------------------- */
+{
+	assert(!port_isr_inside());
+
+	return priv_flg_wait(flg, flags, mode, core_tsk_until64(time), core_tsk_waitUntil64);
+}
+
+#endif
+
 /* -------------------------------------------------------------------------- */
 unsigned flg_waitFor( flg_t *flg, unsigned flags, unsigned mode, uint32_t delay )
 /* -------------------------------------------------------------------------- */
@@ -182,3 +203,16 @@ unsigned flg_clear( flg_t *flg, unsigned flags )
 }
 
 /* -------------------------------------------------------------------------- */
+
+#if OS_FLG_CACHE
+
+/* -------------------------------------------------------------------------- */
+void flg_cacheStat( unsigned *hit, unsigned *miss )
+/* -------------------------------------------------------------------------- */
+{
+	core_slb_stat(FlgCache, hit, miss);
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
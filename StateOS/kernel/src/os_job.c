@@ -35,6 +35,7 @@ void job_init( job_t *job, unsigned limit, fun_t **data )
 	assert(!port_isr_inside());
 	assert(job);
 	assert(limit);
+	assert(!OS_QUEUE_POW2 || (limit & (limit - 1)) == 0);
 	assert(data);
 
 	port_sys_lock();
@@ -80,7 +81,7 @@ void job_kill( job_t *job )
 	job->first = 0;
 	job->next  = 0;
 
-	core_all_wakeup(job, E_STOPPED);
+	core_all_wakeup(job, E_STOPPED, __LOCK);
 
 	port_sys_unlock();
 }
@@ -102,9 +103,12 @@ static
 void priv_job_get( job_t *job, fun_t **fun )
 /* -------------------------------------------------------------------------- */
 {
+#if OS_QUEUE_POW2
+	*fun = job->data[job->first++ & (job->limit - 1)];
+#else
 	*fun = job->data[job->first];
-
-	job->first = (job->first + 1) % job->limit;
+	if (++job->first == job->limit) job->first = 0;
+#endif
 	job->count--;
 }
 
@@ -113,9 +117,12 @@ static
 void priv_job_put( job_t *job, fun_t *fun )
 /* -------------------------------------------------------------------------- */
 {
+#if OS_QUEUE_POW2
+	job->data[job->next++ & (job->limit - 1)] = fun;
+#else
 	job->data[job->next] = fun;
-
-	job->next = (job->next + 1) % job->limit;
+	if (++job->next == job->limit) job->next = 0;
+#endif
 	job->count++;
 }
 
@@ -125,6 +132,7 @@ unsigned priv_job_wait( job_t *job, uint32_t time, unsigned(*wait)(void*,uint32_
 /* -------------------------------------------------------------------------- */
 {
 	tsk_t  * tsk;
+	fun_t  * fun;
 	unsigned event = E_SUCCESS;
 
 	assert(job);
@@ -144,12 +152,14 @@ unsigned priv_job_wait( job_t *job, uint32_t time, unsigned(*wait)(void*,uint32_
 		if (tsk) priv_job_put(job, tsk->tmp.fun);
 	}
 
+	fun = Current->tmp.fun;
+
+	port_sys_unlock();
+
 	if (event == E_SUCCESS)
 	{
-		Current->tmp.fun();
+		fun();
 	}
-	
-	port_sys_unlock();
 
 	return event;
 }
@@ -163,6 +173,21 @@ unsigned job_waitUntil( job_t *job, uint32_t time )
 	return priv_job_wait(job, time, core_tsk_waitUntil);
 }
 
+/* -------------------------------------------------------------------------- */
+
+#if OS_TIME64
+
+/* -------------------------------------------------------------------------- */
+unsigned job_waitUntil64( job_t *job, uint64_t time )
+/* -------------------------------------------------------------------------- */
+{
+	assert(!port_isr_inside());
+
+	return priv_job_wait(job, core_tsk_until64(time), core_tsk_waitUntil64);
+}
+
+#endif
+
 /* -------------------------------------------------------------------------- */
 unsigned job_waitFor( job_t *job, uint32_t delay )
 /* -------------------------------------------------------------------------- */
@@ -224,3 +249,34 @@ unsigned job_sendFor( job_t *job, fun_t *fun, uint32_t delay )
 }
 
 /* -------------------------------------------------------------------------- */
+unsigned job_sendMany( job_t *job, fun_t * const *data, unsigned count )
+/* -------------------------------------------------------------------------- */
+{
+	tsk_t  * tsk;
+	unsigned n;
+
+	assert(job);
+	assert(data || !count);
+
+	port_sys_lock();
+
+	for (n = 0; n < count && job->count < job->limit; n++)
+	{
+		assert(data[n]);
+
+		priv_job_put(job, data[n]);
+
+		if (job->queue)
+		{
+			tsk = core_one_wakeup(job, E_SUCCESS);
+
+			priv_job_get(job, &tsk->tmp.fun);
+		}
+	}
+
+	port_sys_unlock();
+
+	return n;
+}
+
+/* -------------------------------------------------------------------------- */
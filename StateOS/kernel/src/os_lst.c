@@ -29,6 +29,12 @@
 #include "inc/os_lst.h"
 #include "inc/os_tsk.h"
 
+#if OS_LST_CACHE
+_SLB_DEFINE( LstCache, OS_LST_CACHE, sizeof(lst_t) );
+#else
+_SLB_EMPTY( LstCache );
+#endif
+
 /* -------------------------------------------------------------------------- */
 void lst_init( lst_t *lst )
 /* -------------------------------------------------------------------------- */
@@ -53,7 +59,7 @@ lst_t *lst_create( void )
 
 	port_sys_lock();
 
-	lst = core_sys_alloc(sizeof(lst_t));
+	lst = core_slb_alloc(LstCache, sizeof(lst_t));
 	lst_init(lst);
 	lst->res = lst;
 
@@ -71,7 +77,7 @@ void lst_kill( lst_t *lst )
 
 	port_sys_lock();
 
-	core_all_wakeup(lst, E_STOPPED);
+	core_all_wakeup(lst, E_STOPPED, __LOCK);
 
 	port_sys_unlock();
 }
@@ -83,7 +89,7 @@ void lst_delete( lst_t *lst )
 	port_sys_lock();
 
 	lst_kill(lst);
-	core_sys_free(lst->res);
+	core_slb_free(LstCache, lst->res);
 
 	port_sys_unlock();
 }
@@ -125,6 +131,21 @@ unsigned lst_waitUntil( lst_t *lst, void **data, uint32_t time )
 	return priv_lst_wait(lst, data, time, core_tsk_waitUntil);
 }
 
+/* -------------------------------------------------------------------------- */
+
+#if OS_TIME64
+
+/* -------------------------------------------------------------------------- */
+unsigned lst_waitUntil64( lst_t *lst, void **data, uint64_t time )
+/* -------------------------------------------------------------------------- */
+{
+	assert(!port_isr_inside());
+
+	return priv_lst_wait(lst, data, core_tsk_until64(time), core_tsk_waitUntil64);
+}
+
+#endif
+
 /* -------------------------------------------------------------------------- */
 unsigned lst_waitFor( lst_t *lst, void **data, uint32_t delay )
 /* -------------------------------------------------------------------------- */
@@ -154,13 +175,29 @@ void lst_give( lst_t *lst, void *data )
 	}
 	else
 	{
-		ptr = (que_t *)&(lst->next);
-		while (ptr->next) ptr = ptr->next;
-		ptr->next = (que_t *)data - 1;
-		ptr->next->next = 0;
+		ptr = (que_t *)data - 1;
+		ptr->next = 0;
+		if (lst->next)
+			lst->tail->next = ptr;
+		else
+			lst->next = ptr;
+		lst->tail = ptr;
 	}
 
 	port_sys_unlock();
 }
 
 /* -------------------------------------------------------------------------- */
+
+#if OS_LST_CACHE
+
+/* -------------------------------------------------------------------------- */
+void lst_cacheStat( unsigned *hit, unsigned *miss )
+/* -------------------------------------------------------------------------- */
+{
+	core_slb_stat(LstCache, hit, miss);
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
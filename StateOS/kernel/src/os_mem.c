@@ -47,7 +47,8 @@ void mem_bind( mem_t *mem )
 	ptr = mem->data;
 	cnt = mem->limit;
 
-	mem->next = 0;
+	mem->next  = 0;
+	mem->count = 0;
 	while (cnt--) { mem_give(mem, ++ptr); ptr += mem->size; }
 
 	port_sys_unlock();
@@ -108,7 +109,7 @@ void mem_kill( mem_t *mem )
 
 	port_sys_lock();
 
-	core_all_wakeup(mem, E_STOPPED);
+	core_all_wakeup(mem, E_STOPPED, __LOCK);
 
 	port_sys_unlock();
 }
@@ -125,6 +126,85 @@ void mem_delete( mem_t *mem )
 	port_sys_unlock();
 }
 
+/* -------------------------------------------------------------------------- */
+void mem_setZero( mem_t *mem, bool zero )
+/* -------------------------------------------------------------------------- */
+{
+	assert(mem);
+
+	mem->nozero = !zero;
+}
+
+/* -------------------------------------------------------------------------- */
+// take memory object from the memory pool object without masking interrupts
+// return false if the memory pool is empty or lock-free services are not available
+
+static
+bool priv_mem_take( mem_t *mem, void **data )
+/* -------------------------------------------------------------------------- */
+{
+#if OS_MEM_LOCKFREE && port_ex_supported
+	que_t *ptr;
+
+	do
+	{
+		ptr = port_ex_load((void **)&mem->next);
+		if (ptr == 0)
+		{
+			port_ex_clear();
+			return false;
+		}
+	}
+	while (!port_ex_store((void **)&mem->next, ptr->next));
+
+	port_ex_add(&mem->count, -1);
+
+	*data = ptr + 1;
+
+	return true;
+#else
+	(void) mem;
+	(void) data;
+
+	return false;
+#endif
+}
+
+/* -------------------------------------------------------------------------- */
+// give memory object to the memory pool object without masking interrupts
+// return false if there are tasks waiting for the memory pool or lock-free services are not available
+
+static
+bool priv_mem_give( mem_t *mem, void *data )
+/* -------------------------------------------------------------------------- */
+{
+#if OS_MEM_LOCKFREE && port_ex_supported
+	que_t *ptr = (que_t *)data - 1;
+
+	// the counter is incremented first, so it is never less than the number of memory objects in the free list
+	port_ex_add(&mem->count, 1);
+
+	do
+	{
+		ptr->next = port_ex_load((void **)&mem->next);
+		if (mem->queue)
+		{
+			port_ex_clear();
+			port_ex_add(&mem->count, -1);
+			return false;
+		}
+	}
+	while (!port_ex_store((void **)&mem->next, ptr));
+
+	return true;
+#else
+	(void) mem;
+	(void) data;
+
+	return false;
+#endif
+}
+
 /* -------------------------------------------------------------------------- */
 static
 unsigned priv_mem_wait( mem_t *mem, void **data, uint32_t time, unsigned(*wait)(void*,uint32_t) )
@@ -137,28 +217,32 @@ unsigned priv_mem_wait( mem_t *mem, void **data, uint32_t time, unsigned(*wait)(
 	assert(mem);
 	assert(data);
 
-	port_sys_lock();
-
-	if (mem->next)
+	if (!priv_mem_take(mem, data))
 	{
-		*data = mem->next + 1;
-		mem->next = mem->next->next;
+		port_sys_lock();
+
+		if (mem->next)
+		{
+			*data = mem->next + 1;
+			mem->next = mem->next->next;
+			mem->count--;
+		}
+		else
+		{
+			Current->tmp.data = data;
+			event = wait(mem, time);
+		}
+
+		port_sys_unlock();
 	}
-	else
-	{
-		Current->tmp.data = data;
-		event = wait(mem, time);
-	}
-	
-	if (event == E_SUCCESS)
+
+	if (event == E_SUCCESS && !mem->nozero)
 	{
 		ptr = *data;
 		cnt = mem->size;
 		while (cnt--) *ptr++ = 0;
 	}
 
-	port_sys_unlock();
-
 	return event;
 }
 
@@ -171,6 +255,21 @@ unsigned mem_waitUntil( mem_t *mem, void **data, uint32_t time )
 	return priv_mem_wait(mem, data, time, core_tsk_waitUntil);
 }
 
+/* -------------------------------------------------------------------------- */
+
+#if OS_TIME64
+
+/* -------------------------------------------------------------------------- */
+unsigned mem_waitUntil64( mem_t *mem, void **data, uint64_t time )
+/* -------------------------------------------------------------------------- */
+{
+	assert(!port_isr_inside());
+
+	return priv_mem_wait(mem, data, core_tsk_until64(time), core_tsk_waitUntil64);
+}
+
+#endif
+
 /* -------------------------------------------------------------------------- */
 unsigned mem_waitFor( mem_t *mem, void **data, uint32_t delay )
 /* -------------------------------------------------------------------------- */
@@ -190,6 +289,9 @@ void mem_give( mem_t *mem, void *data )
 	assert(mem);
 	assert(data);
 
+	if (priv_mem_give(mem, data))
+		return;
+
 	port_sys_lock();
 
 	tsk = core_one_wakeup(mem, E_SUCCESS);
@@ -200,10 +302,10 @@ void mem_give( mem_t *mem, void *data )
 	}
 	else
 	{
-		ptr = (que_t *)&(mem->next);
-		while (ptr->next) ptr = ptr->next;
-		ptr->next = (que_t *)data - 1;
-		ptr->next->next = 0;
+		ptr = (que_t *)data - 1;
+		ptr->next = mem->next;
+		mem->next = ptr;
+		mem->count++;
 	}
 
 	port_sys_unlock();
@@ -36,6 +36,7 @@ void msg_init( msg_t *msg, unsigned limit, unsigned *data )
 	assert(!port_isr_inside());
 	assert(msg);
 	assert(limit);
+	assert(!OS_QUEUE_POW2 || (limit & (limit - 1)) == 0);
 	assert(data);
 
 	port_sys_lock();
@@ -81,7 +82,7 @@ void msg_kill( msg_t *msg )
 	msg->first = 0;
 	msg->next  = 0;
 
-	core_all_wakeup(msg, E_STOPPED);
+	core_all_wakeup(msg, E_STOPPED, __LOCK);
 
 	port_sys_unlock();
 }
@@ -103,9 +104,12 @@ static
 void priv_msg_get( msg_t *msg, unsigned *data )
 /* -------------------------------------------------------------------------- */
 {
+#if OS_QUEUE_POW2
+	*data = msg->data[msg->first++ & (msg->limit - 1)];
+#else
 	*data = msg->data[msg->first];
-
-	msg->first = (msg->first + 1) % msg->limit;
+	if (++msg->first == msg->limit) msg->first = 0;
+#endif
 	msg->count--;
 }
 
@@ -114,9 +118,12 @@ static
 void priv_msg_put( msg_t *msg, unsigned data )
 /* -------------------------------------------------------------------------- */
 {
+#if OS_QUEUE_POW2
+	msg->data[msg->next++ & (msg->limit - 1)] = data;
+#else
 	msg->data[msg->next] = data;
-
-	msg->next = (msg->next + 1) % msg->limit;
+	if (++msg->next == msg->limit) msg->next = 0;
+#endif
 	msg->count++;
 }
 
@@ -143,11 +150,13 @@ unsigned priv_msg_wait( msg_t *msg, unsigned *data, uint32_t time, unsigned(*wai
 	{
 		priv_msg_get(msg, data);
 
-		tsk = core_one_wakeup(msg, E_SUCCESS);
+		tsk = core_one_handoff(msg, E_SUCCESS);
 
 		if (tsk) priv_msg_put(msg, tsk->tmp.msg);
 	}
 
+	core_trc_put(TRC_TAKE, msg, event);
+
 	port_sys_unlock();
 
 	return event;
@@ -162,6 +171,21 @@ unsigned msg_waitUntil( msg_t *msg, unsigned *data, uint32_t time )
 	return priv_msg_wait(msg, data, time, core_tsk_waitUntil);
 }
 
+/* -------------------------------------------------------------------------- */
+
+#if OS_TIME64
+
+/* -------------------------------------------------------------------------- */
+unsigned msg_waitUntil64( msg_t *msg, unsigned *data, uint64_t time )
+/* -------------------------------------------------------------------------- */
+{
+	assert(!port_isr_inside());
+
+	return priv_msg_wait(msg, data, core_tsk_until64(time), core_tsk_waitUntil64);
+}
+
+#endif
+
 /* -------------------------------------------------------------------------- */
 unsigned msg_waitFor( msg_t *msg, unsigned *data, uint32_t delay )
 /* -------------------------------------------------------------------------- */
@@ -193,11 +217,13 @@ unsigned priv_msg_send( msg_t *msg, unsigned data, uint32_t time, unsigned(*wait
 	{
 		priv_msg_put(msg, data);
 
-		tsk = core_one_wakeup(msg, E_SUCCESS);
+		tsk = core_one_handoff(msg, E_SUCCESS);
 
 		if (tsk) priv_msg_get(msg, tsk->tmp.data);
 	}
 
+	core_trc_put(TRC_GIVE, msg, event);
+
 	port_sys_unlock();
 
 	return event;
@@ -222,3 +248,61 @@ unsigned msg_sendFor( msg_t *msg, unsigned data, uint32_t delay )
 }
 
 /* -------------------------------------------------------------------------- */
+unsigned msg_sendMany( msg_t *msg, const unsigned *data, unsigned count )
+/* -------------------------------------------------------------------------- */
+{
+	tsk_t  * tsk;
+	unsigned n;
+
+	assert(msg);
+	assert(data || !count);
+
+	port_sys_lock();
+
+	for (n = 0; n < count && msg->count < msg->limit; n++)
+	{
+		priv_msg_put(msg, data[n]);
+
+		if (msg->queue)
+		{
+			tsk = core_one_handoff(msg, E_SUCCESS);
+
+			priv_msg_get(msg, tsk->tmp.data);
+		}
+	}
+
+	port_sys_unlock();
+
+	return n;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned msg_waitMany( msg_t *msg, unsigned *data, unsigned count )
+/* -------------------------------------------------------------------------- */
+{
+	tsk_t  * tsk;
+	unsigned n;
+
+	assert(msg);
+	assert(data || !count);
+
+	port_sys_lock();
+
+	for (n = 0; n < count && msg->count > 0; n++)
+	{
+		priv_msg_get(msg, &data[n]);
+
+		if (msg->queue)
+		{
+			tsk = core_one_handoff(msg, E_SUCCESS);
+
+			priv_msg_put(msg, tsk->tmp.msg);
+		}
+	}
+
+	port_sys_unlock();
+
+	return n;
+}
+
+/* -------------------------------------------------------------------------- */
@@ -29,6 +29,12 @@
 #include "inc/os_mtx.h"
 #include "inc/os_tsk.h"
 
+#if OS_MTX_CACHE
+_SLB_DEFINE( MtxCache, OS_MTX_CACHE, sizeof(mtx_t) );
+#else
+_SLB_EMPTY( MtxCache );
+#endif
+
 /* -------------------------------------------------------------------------- */
 void mtx_init( mtx_t *mtx )
 /* -------------------------------------------------------------------------- */
@@ -43,6 +49,22 @@ void mtx_init( mtx_t *mtx )
 	port_sys_unlock();
 }
 
+/* -------------------------------------------------------------------------- */
+void mtx_initCeiling( mtx_t *mtx, unsigned prio )
+/* -------------------------------------------------------------------------- */
+{
+	assert(!port_isr_inside());
+	assert(mtx);
+
+	port_sys_lock();
+
+	mtx_init(mtx);
+	mtx->prio = prio;
+	mtx->top  = prio;
+
+	port_sys_unlock();
+}
+
 /* -------------------------------------------------------------------------- */
 mtx_t *mtx_create( void )
 /* -------------------------------------------------------------------------- */
@@ -53,7 +75,7 @@ mtx_t *mtx_create( void )
 
 	port_sys_lock();
 
-	mtx = core_sys_alloc(sizeof(mtx_t));
+	mtx = core_slb_alloc(MtxCache, sizeof(mtx_t));
 	mtx_init(mtx);
 	mtx->res = mtx;
 
@@ -62,6 +84,24 @@ mtx_t *mtx_create( void )
 	return mtx;
 }
 
+/* -------------------------------------------------------------------------- */
+mtx_t *mtx_createCeiling( unsigned prio )
+/* -------------------------------------------------------------------------- */
+{
+	mtx_t *mtx;
+
+	assert(!port_isr_inside());
+
+	port_sys_lock();
+
+	mtx = mtx_create();
+	mtx->prio = mtx->top = prio;
+
+	port_sys_unlock();
+
+	return mtx;
+}
+
 /* -------------------------------------------------------------------------- */
 static
 void priv_mtx_link( mtx_t *mtx, tsk_t *tsk )
@@ -73,8 +113,17 @@ void priv_mtx_link( mtx_t *mtx, tsk_t *tsk )
 
 	if (tsk)
 	{
+		mtx->back = 0;
 		mtx->list = tsk->mlist;
+		if (tsk->mlist)
+		tsk->mlist->back = mtx;
 		tsk->mlist = mtx;
+
+		if (tsk->mprio < mtx->top)
+			tsk->mprio = mtx->top;
+
+		if (tsk->prio < mtx->prio)
+			core_tsk_prio(tsk, mtx->prio);
 	}
 }
 
@@ -84,7 +133,6 @@ void priv_mtx_unlink( mtx_t *mtx )
 /* -------------------------------------------------------------------------- */
 {
 	tsk_t *tsk;
-	mtx_t *lst;
 
 	assert(mtx);
 
@@ -92,16 +140,20 @@ void priv_mtx_unlink( mtx_t *mtx )
 	{
 		tsk = mtx->owner;
 
-		if (tsk->mlist == mtx)
-			tsk->mlist = mtx->list;
-
-		for (lst = tsk->mlist; lst; lst = lst->list)
-			if (lst->list == mtx)
-				lst->list = mtx->list;
+		if (mtx->list)
+		mtx->list->back = mtx->back;
+		if (mtx->back)
+		mtx->back->list = mtx->list;
+		else
+		tsk->mlist = mtx->list;
 
 		mtx->list  = 0;
+		mtx->back  = 0;
 		mtx->owner = 0;
 
+		if (tsk->mprio == mtx->top)
+			core_tsk_mprio(tsk);
+
 		core_tsk_prio(tsk, tsk->basic);
 	}
 }
@@ -119,7 +171,7 @@ void mtx_kill( mtx_t *mtx )
 
 	mtx->count = 0;
 
-	core_all_wakeup(mtx, E_STOPPED);
+	core_all_wakeup(mtx, E_STOPPED, __LOCK);
 
 	port_sys_unlock();
 }
@@ -131,7 +183,7 @@ void mtx_delete( mtx_t *mtx )
 	port_sys_lock();
 
 	mtx_kill(mtx);
-	core_sys_free(mtx->res);
+	core_slb_free(MtxCache, mtx->res);
 
 	port_sys_unlock();
 }
@@ -144,6 +196,7 @@ unsigned priv_mtx_wait( mtx_t *mtx, uint32_t time, unsigned(*wait)(void*,uint32_
 	unsigned event = E_TIMEOUT;
 
 	assert(mtx);
+	assert(mtx->prio == 0 || mtx->prio >= Current->basic);
 
 	port_sys_lock();
 
@@ -163,6 +216,11 @@ unsigned priv_mtx_wait( mtx_t *mtx, uint32_t time, unsigned(*wait)(void*,uint32_
 		}
 	}
 	else
+	if (mtx->prio)
+	{
+		event = wait(mtx, time);
+	}
+	else
 	{
 		if (mtx->owner->prio < Current->prio)
 			core_tsk_prio(mtx->owner, Current->prio);
@@ -172,6 +230,8 @@ unsigned priv_mtx_wait( mtx_t *mtx, uint32_t time, unsigned(*wait)(void*,uint32_
 		Current->mtree = 0;
 	}
 	
+	core_trc_put(TRC_TAKE, mtx, event);
+
 	port_sys_unlock();
 
 	return event;
@@ -186,6 +246,21 @@ unsigned mtx_waitUntil( mtx_t *mtx, uint32_t time )
 	return priv_mtx_wait(mtx, time, core_tsk_waitUntil);
 }
 
+/* -------------------------------------------------------------------------- */
+
+#if OS_TIME64
+
+/* -------------------------------------------------------------------------- */
+unsigned mtx_waitUntil64( mtx_t *mtx, uint64_t time )
+/* -------------------------------------------------------------------------- */
+{
+	assert(!port_isr_inside());
+
+	return priv_mtx_wait(mtx, core_tsk_until64(time), core_tsk_waitUntil64);
+}
+
+#endif
+
 /* -------------------------------------------------------------------------- */
 unsigned mtx_waitFor( mtx_t *mtx, uint32_t delay )
 /* -------------------------------------------------------------------------- */
@@ -221,9 +296,24 @@ unsigned mtx_give( mtx_t *mtx )
 		event = E_SUCCESS;
 	}
 
+	core_trc_put(TRC_GIVE, mtx, event);
+
 	port_sys_unlock();
 
 	return event;
 }
 
 /* -------------------------------------------------------------------------- */
+
+#if OS_MTX_CACHE
+
+/* -------------------------------------------------------------------------- */
+void mtx_cacheStat( unsigned *hit, unsigned *miss )
+/* -------------------------------------------------------------------------- */
+{
+	core_slb_stat(MtxCache, hit, miss);
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
@@ -28,6 +28,12 @@
 
 #include "inc/os_mut.h"
 
+#if OS_MUT_CACHE
+_SLB_DEFINE( MutCache, OS_MUT_CACHE, sizeof(mut_t) );
+#else
+_SLB_EMPTY( MutCache );
+#endif
+
 /* -------------------------------------------------------------------------- */
 void mut_init( mut_t *mut )
 /* -------------------------------------------------------------------------- */
@@ -52,7 +58,7 @@ mut_t *mut_create( void )
 
 	port_sys_lock();
 
-	mut = core_sys_alloc(sizeof(mut_t));
+	mut = core_slb_alloc(MutCache, sizeof(mut_t));
 	mut_init(mut);
 	mut->res = mut;
 
@@ -70,7 +76,7 @@ void mut_kill( mut_t *mut )
 
 	port_sys_lock();
 
-	core_all_wakeup(mut, E_STOPPED);
+	core_all_wakeup(mut, E_STOPPED, __LOCK);
 
 	port_sys_unlock();
 }
@@ -82,7 +88,7 @@ void mut_delete( mut_t *mut )
 	port_sys_lock();
 
 	mut_kill(mut);
-	core_sys_free(mut->res);
+	core_slb_free(MutCache, mut->res);
 
 	port_sys_unlock();
 }
@@ -123,6 +129,21 @@ unsigned mut_waitUntil( mut_t *mut, uint32_t time )
 	return priv_mut_wait(mut, time, core_tsk_waitUntil);
 }
 
+/* -------------------------------------------------------------------------- */
+
+#if OS_TIME64
+
+/* -------------------------------------------------------------------------- */
+unsigned mut_waitUntil64( mut_t *mut, uint64_t time )
+/* -------------------------------------------------------------------------- */
+{
+	assert(!port_isr_inside());
+
+	return priv_mut_wait(mut, core_tsk_until64(time), core_tsk_waitUntil64);
+}
+
+#endif
+
 /* -------------------------------------------------------------------------- */
 unsigned mut_waitFor( mut_t *mut, uint32_t delay )
 /* -------------------------------------------------------------------------- */
@@ -155,3 +176,16 @@ unsigned mut_give( mut_t *mut )
 }
 
 /* -------------------------------------------------------------------------- */
+
+#if OS_MUT_CACHE
+
+/* -------------------------------------------------------------------------- */
+void mut_cacheStat( unsigned *hit, unsigned *miss )
+/* -------------------------------------------------------------------------- */
+{
+	core_slb_stat(MutCache, hit, miss);
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
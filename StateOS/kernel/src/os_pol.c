@@ -0,0 +1,225 @@
+/******************************************************************************
+
+    @file    StateOS: os_pol.c
+    @author  Rajmund Szymanski
+    @date    24.10.2017
+    @brief   This file provides set of functions for StateOS.
+
+ ******************************************************************************
+
+    StateOS - Copyright (C) 2013 Rajmund Szymanski.
+
+    This file is part of StateOS distribution.
+
+    StateOS is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published
+    by the Free Software Foundation; either version 3 of the License,
+    or (at your option) any later version.
+
+    StateOS is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+ ******************************************************************************/
+
+#include <os.h>
+
+/* -------------------------------------------------------------------------- */
+static
+tsk_t *priv_pol_tsk( pol_t *pol, unsigned idx )
+/* -------------------------------------------------------------------------- */
+{
+	return (tsk_t *)(pol->work + idx * _POL_SLOT(pol->size));
+}
+
+/* -------------------------------------------------------------------------- */
+// the pool is passed to the worker in the tmp field, the worker never returns
+
+static
+void priv_pol_worker( void )
+/* -------------------------------------------------------------------------- */
+{
+	pol_t *pol = Current->tmp.data;
+	pjb_t  job;
+
+	for (;;)
+	{
+		if (box_wait(&pol->box, &job) == E_SUCCESS)
+		{
+			job.fun(job.arg);
+
+			port_sys_lock();
+			pol->done++;
+			port_sys_unlock();
+		}
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+void pol_init( pol_t *pol, unsigned workers, unsigned prio, unsigned size, unsigned limit, void *data )
+/* -------------------------------------------------------------------------- */
+{
+	assert(!port_isr_inside());
+	assert(pol);
+	assert(workers);
+	assert(size);
+	assert(limit);
+	assert(data);
+
+	port_sys_lock();
+
+	memset(pol, 0, sizeof(pol_t));
+
+	pol->prio = prio;
+	pol->num  = workers;
+	pol->size = size;
+	pol->work = data;
+
+	box_init(&pol->box, limit, sizeof(pjb_t), pol->work + workers * _POL_SLOT(size));
+	pol_start(pol);
+
+	port_sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+pol_t *pol_create( unsigned workers, unsigned prio, unsigned size, unsigned limit )
+/* -------------------------------------------------------------------------- */
+{
+	pol_t *pol;
+
+	assert(!port_isr_inside());
+	assert(workers);
+	assert(size);
+	assert(limit);
+
+	port_sys_lock();
+
+	pol = core_sys_alloc(ABOVE(sizeof(pol_t)) + _POL_SIZE(workers, size, limit));
+	pol_init(pol, workers, prio, size, limit, (void *)ABOVE(pol + 1));
+	pol->box.res = pol;
+
+	port_sys_unlock();
+
+	return pol;
+}
+
+/* -------------------------------------------------------------------------- */
+void pol_start( pol_t *pol )
+/* -------------------------------------------------------------------------- */
+{
+	tsk_t  * tsk;
+	unsigned i;
+
+	assert(!port_isr_inside());
+	assert(pol);
+
+	port_sys_lock();
+
+	for (i = 0; i < pol->num; i++)
+	{
+		tsk = priv_pol_tsk(pol, i);
+
+		if (!pol->init || tsk->obj.id == ID_STOPPED)
+		{
+			tsk_init(tsk, pol->prio, priv_pol_worker, (char *)tsk + ABOVE(sizeof(tsk_t)), pol->size);
+			tsk->tmp.data = pol;
+		}
+	}
+
+	pol->init = true;
+
+	port_sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+void pol_kill( pol_t *pol )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned i;
+
+	assert(!port_isr_inside());
+	assert(pol);
+
+	port_sys_lock();
+
+	for (i = 0; i < pol->num; i++)
+		tsk_kill(priv_pol_tsk(pol, i));
+
+	box_kill(&pol->box);
+
+	port_sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+void pol_delete( pol_t *pol )
+/* -------------------------------------------------------------------------- */
+{
+	port_sys_lock();
+
+	pol_kill(pol);
+	core_sys_free(pol->box.res);
+
+	port_sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+static
+unsigned priv_pol_send( pol_t *pol, act_t *fun, void *arg, uint32_t time, unsigned(*send)(box_t*,const void*,uint32_t) )
+/* -------------------------------------------------------------------------- */
+{
+	pjb_t    job = { fun, arg };
+	unsigned event;
+
+	assert(pol);
+	assert(fun);
+
+	port_sys_lock();
+
+	event = send(&pol->box, &job, time);
+
+	if (event == E_SUCCESS && pol->peak < pol->box.count)
+		pol->peak = pol->box.count;
+
+	port_sys_unlock();
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned pol_sendUntil( pol_t *pol, act_t *fun, void *arg, uint32_t time )
+/* -------------------------------------------------------------------------- */
+{
+	assert(!port_isr_inside());
+
+	return priv_pol_send(pol, fun, arg, time, box_sendUntil);
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned pol_sendFor( pol_t *pol, act_t *fun, void *arg, uint32_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	assert(!port_isr_inside() || !delay);
+
+	return priv_pol_send(pol, fun, arg, delay, box_sendFor);
+}
+
+/* -------------------------------------------------------------------------- */
+void pol_stat( pol_t *pol, unsigned *done, unsigned *count, unsigned *peak )
+/* -------------------------------------------------------------------------- */
+{
+	assert(pol);
+
+	port_sys_lock();
+
+	if (done)  *done  = pol->done;
+	if (count) *count = pol->box.count;
+	if (peak)  *peak  = pol->peak;
+
+	port_sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
@@ -28,6 +28,12 @@
 
 #include "inc/os_sem.h"
 
+#if OS_SEM_CACHE
+_SLB_DEFINE( SemCache, OS_SEM_CACHE, sizeof(sem_t) );
+#else
+_SLB_EMPTY( SemCache );
+#endif
+
 /* -------------------------------------------------------------------------- */
 void sem_init( sem_t *sem, unsigned init, unsigned limit )
 /* -------------------------------------------------------------------------- */
@@ -57,7 +63,7 @@ sem_t *sem_create( unsigned init, unsigned limit )
 
 	port_sys_lock();
 
-	sem = core_sys_alloc(sizeof(sem_t));
+	sem = core_slb_alloc(SemCache, sizeof(sem_t));
 	sem_init(sem, init, limit);
 	sem->res = sem;
 
@@ -77,7 +83,7 @@ void sem_kill( sem_t *sem )
 
 	sem->count = 0;
 
-	core_all_wakeup(sem, E_STOPPED);
+	core_all_wakeup(sem, E_STOPPED, __LOCK);
 
 	port_sys_unlock();
 }
@@ -89,7 +95,7 @@ void sem_delete( sem_t *sem )
 	port_sys_lock();
 
 	sem_kill(sem);
-	core_sys_free(sem->res);
+	core_slb_free(SemCache, sem->res);
 
 	port_sys_unlock();
 }
@@ -108,9 +114,11 @@ unsigned priv_sem_wait( sem_t *sem, uint32_t time, unsigned(*wait)(void*,uint32_
 	if (sem->count == 0)
 		event = wait(sem, time);
 	else
-	if (core_one_wakeup(sem, E_SUCCESS) == 0)
+	if (core_one_handoff(sem, E_SUCCESS) == 0)
 		sem->count--;
 
+	core_trc_put(TRC_TAKE, sem, event);
+
 	port_sys_unlock();
 
 	return event;
@@ -125,6 +133,21 @@ unsigned sem_waitUntil( sem_t *sem, uint32_t time )
 	return priv_sem_wait(sem, time, core_tsk_waitUntil);
 }
 
+/* -------------------------------------------------------------------------- */
+
+#if OS_TIME64
+
+/* -------------------------------------------------------------------------- */
+unsigned sem_waitUntil64( sem_t *sem, uint64_t time )
+/* -------------------------------------------------------------------------- */
+{
+	assert(!port_isr_inside());
+
+	return priv_sem_wait(sem, core_tsk_until64(time), core_tsk_waitUntil64);
+}
+
+#endif
+
 /* -------------------------------------------------------------------------- */
 unsigned sem_waitFor( sem_t *sem, uint32_t delay )
 /* -------------------------------------------------------------------------- */
@@ -148,9 +171,11 @@ unsigned priv_sem_send( sem_t *sem, uint32_t time, unsigned(*wait)(void*,uint32_
 	if (sem->count >= sem->limit)
 		event = wait(sem, time);
 	else
-	if (core_one_wakeup(sem, E_SUCCESS) == 0)
+	if (core_one_handoff(sem, E_SUCCESS) == 0)
 		sem->count++;
 
+	core_trc_put(TRC_GIVE, sem, event);
+
 	port_sys_unlock();
 
 	return event;
@@ -175,3 +200,16 @@ unsigned sem_sendFor( sem_t *sem, uint32_t delay )
 }
 
 /* -------------------------------------------------------------------------- */
+
+#if OS_SEM_CACHE
+
+/* -------------------------------------------------------------------------- */
+void sem_cacheStat( unsigned *hit, unsigned *miss )
+/* -------------------------------------------------------------------------- */
+{
+	core_slb_stat(SemCache, hit, miss);
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
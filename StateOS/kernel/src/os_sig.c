@@ -28,6 +28,12 @@
 
 #include "inc/os_sig.h"
 
+#if OS_SIG_CACHE
+_SLB_DEFINE( SigCache, OS_SIG_CACHE, sizeof(sig_t) );
+#else
+_SLB_EMPTY( SigCache );
+#endif
+
 /* -------------------------------------------------------------------------- */
 void sig_init( sig_t *sig, unsigned type )
 /* -------------------------------------------------------------------------- */
@@ -54,7 +60,7 @@ sig_t *sig_create( unsigned type )
 
 	port_sys_lock();
 
-	sig = core_sys_alloc(sizeof(sig_t));
+	sig = core_slb_alloc(SigCache, sizeof(sig_t));
 	sig_init(sig, type);
 	sig->res = sig;
 
@@ -74,7 +80,7 @@ void sig_kill( sig_t *sig )
 
 	sig->flag = 0;
 	
-	core_all_wakeup(sig, E_STOPPED);
+	core_all_wakeup(sig, E_STOPPED, __LOCK);
 
 	port_sys_unlock();
 }
@@ -86,7 +92,7 @@ void sig_delete( sig_t *sig )
 	port_sys_lock();
 
 	sig_kill(sig);
-	core_sys_free(sig->res);
+	core_slb_free(SigCache, sig->res);
 
 	port_sys_unlock();
 }
@@ -125,6 +131,21 @@ unsigned sig_waitUntil( sig_t *sig, uint32_t time )
 	return priv_sig_wait(sig, time, core_tsk_waitUntil);
 }
 
+/* -------------------------------------------------------------------------- */
+
+#if OS_TIME64
+
+/* -------------------------------------------------------------------------- */
+unsigned sig_waitUntil64( sig_t *sig, uint64_t time )
+/* -------------------------------------------------------------------------- */
+{
+	assert(!port_isr_inside());
+
+	return priv_sig_wait(sig, core_tsk_until64(time), core_tsk_waitUntil64);
+}
+
+#endif
+
 /* -------------------------------------------------------------------------- */
 unsigned sig_waitFor( sig_t *sig, uint32_t delay )
 /* -------------------------------------------------------------------------- */
@@ -151,7 +172,7 @@ void sig_give( sig_t *sig )
 	}
 	else
 	{
-		core_all_wakeup(sig, E_SUCCESS);
+		core_all_wakeup(sig, E_SUCCESS, __LOCK);
 	}
 
 	port_sys_unlock();
@@ -167,3 +188,16 @@ void sig_clear( sig_t *sig )
 }
 
 /* -------------------------------------------------------------------------- */
+
+#if OS_SIG_CACHE
+
+/* -------------------------------------------------------------------------- */
+void sig_cacheStat( unsigned *hit, unsigned *miss )
+/* -------------------------------------------------------------------------- */
+{
+	core_slb_stat(SigCache, hit, miss);
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
@@ -28,6 +28,12 @@
 
 #include "inc/os_tmr.h"
 
+#if OS_TMR_CACHE
+_SLB_DEFINE( TmrCache, OS_TMR_CACHE, sizeof(tmr_t) );
+#else
+_SLB_EMPTY( TmrCache );
+#endif
+
 /* -------------------------------------------------------------------------- */
 void tmr_init( tmr_t *tmr, fun_t *state )
 /* -------------------------------------------------------------------------- */
@@ -54,7 +60,7 @@ tmr_t *tmr_create( fun_t *state )
 
 	port_sys_lock();
 
-	tmr = core_sys_alloc(sizeof(tmr_t));
+	tmr = core_slb_alloc(TmrCache, sizeof(tmr_t));
 	tmr_init(tmr, state);
 	tmr->obj.res = tmr;
 
@@ -72,11 +78,15 @@ void tmr_kill( tmr_t *tmr )
 
 	port_sys_lock();
 
+	// a stopped timer may still have tasks waiting for its posted callback procedure
+	core_all_wakeup(tmr, E_STOPPED, __LOCK);
+
 	if (tmr->obj.id != ID_STOPPED)
-	{
-		core_all_wakeup(tmr, E_STOPPED);
 		core_tmr_remove(tmr);
-	}
+
+#if OS_TMR_TASK
+	core_tmr_drop(tmr);
+#endif
 
 	port_sys_unlock();
 }
@@ -88,7 +98,7 @@ void tmr_delete( tmr_t *tmr )
 	port_sys_lock();
 
 	tmr_kill(tmr);
-	core_sys_free(tmr->obj.res);
+	core_slb_free(TmrCache, tmr->obj.res);
 
 	port_sys_unlock();
 }
@@ -100,6 +110,14 @@ void priv_tmr_start( tmr_t *tmr )
 {
 	assert(!port_isr_inside());
 
+#if OS_TMR_TASK
+	core_tmr_task();
+#endif
+
+#if OS_TIME64
+	tmr->hops = 0;
+#endif
+
 	if (tmr->obj.id != ID_STOPPED)
 	core_tmr_remove(tmr);
 	core_tmr_insert(tmr, ID_TIMER);
@@ -116,12 +134,56 @@ void tmr_startUntil( tmr_t *tmr, uint32_t time )
 	tmr->start  = Counter;
 	tmr->delay  = time - tmr->start;
 	tmr->period = 0;
+	tmr->slack  = 0;
 
 	priv_tmr_start(tmr);
 
 	port_sys_unlock();
 }
 
+/* -------------------------------------------------------------------------- */
+
+#if OS_TIME64
+
+/* -------------------------------------------------------------------------- */
+void tmr_startUntil64( tmr_t *tmr, uint64_t time )
+/* -------------------------------------------------------------------------- */
+{
+	uint64_t now;
+	uint32_t hops;
+
+	assert(tmr);
+
+	port_sys_lock();
+
+	now  = core_sys_time64();
+	time = time > now ? time - now : 0;
+	hops = 0;
+
+	tmr->start  = (uint32_t)now;
+	tmr->delay  = INFINITE;
+	tmr->period = 0;
+	tmr->slack  = 0;
+
+	if (time < (uint64_t)INFINITE << 31)
+	{
+		hops = (uint32_t)(time >> 31);
+		tmr->delay = (uint32_t)time & ((1UL << 31) - 1);
+		if (tmr->delay == 0 && hops > 0)
+		{
+			hops--;
+			tmr->delay = 1UL << 31;
+		}
+	}
+
+	priv_tmr_start(tmr);
+	tmr->hops = hops;
+
+	port_sys_unlock();
+}
+
+#endif
+
 /* -------------------------------------------------------------------------- */
 void tmr_start( tmr_t *tmr, uint32_t delay, uint32_t period )
 /* -------------------------------------------------------------------------- */
@@ -133,6 +195,25 @@ void tmr_start( tmr_t *tmr, uint32_t delay, uint32_t period )
 	tmr->start  = Counter;
 	tmr->delay  = delay;
 	tmr->period = period;
+	tmr->slack  = 0;
+
+	priv_tmr_start(tmr);
+
+	port_sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+void tmr_startSlack( tmr_t *tmr, uint32_t delay, uint32_t period, uint32_t slack )
+/* -------------------------------------------------------------------------- */
+{
+	assert(tmr);
+
+	port_sys_lock();
+
+	tmr->start  = Counter;
+	tmr->delay  = core_tmr_slack(tmr->start, delay, slack);
+	tmr->period = period;
+	tmr->slack  = slack;
 
 	priv_tmr_start(tmr);
 
@@ -151,12 +232,32 @@ void tmr_startFrom( tmr_t *tmr, uint32_t delay, uint32_t period, fun_t *proc )
 	tmr->start  = Counter;
 	tmr->delay  = delay;
 	tmr->period = period;
+	tmr->slack  = 0;
 
 	priv_tmr_start(tmr);
 
 	port_sys_unlock();
 }
 
+/* -------------------------------------------------------------------------- */
+void tmr_setHandlerMode( tmr_t *tmr, bool on )
+/* -------------------------------------------------------------------------- */
+{
+	assert(!port_isr_inside());
+	assert(tmr);
+
+#if OS_TMR_TASK
+	port_sys_lock();
+
+	tmr->isr = on;
+
+	port_sys_unlock();
+#else
+	(void) tmr;
+	(void) on;
+#endif
+}
+
 /* -------------------------------------------------------------------------- */
 static
 unsigned priv_tmr_wait( tmr_t *tmr, uint32_t time, unsigned(*wait)(void*,uint32_t) )
@@ -187,6 +288,21 @@ unsigned tmr_waitUntil( tmr_t *tmr, uint32_t time )
 	return priv_tmr_wait(tmr, time, core_tsk_waitUntil);
 }
 
+/* -------------------------------------------------------------------------- */
+
+#if OS_TIME64
+
+/* -------------------------------------------------------------------------- */
+unsigned tmr_waitUntil64( tmr_t *tmr, uint64_t time )
+/* -------------------------------------------------------------------------- */
+{
+	assert(!port_isr_inside());
+
+	return priv_tmr_wait(tmr, core_tsk_until64(time), core_tsk_waitUntil64);
+}
+
+#endif
+
 /* -------------------------------------------------------------------------- */
 unsigned tmr_waitFor( tmr_t *tmr, uint32_t delay )
 /* -------------------------------------------------------------------------- */
@@ -197,3 +313,16 @@ unsigned tmr_waitFor( tmr_t *tmr, uint32_t delay )
 }
 
 /* -------------------------------------------------------------------------- */
+
+#if OS_TMR_CACHE
+
+/* -------------------------------------------------------------------------- */
+void tmr_cacheStat( unsigned *hit, unsigned *miss )
+/* -------------------------------------------------------------------------- */
+{
+	core_slb_stat(TmrCache, hit, miss);
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
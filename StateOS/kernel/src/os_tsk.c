@@ -28,6 +28,12 @@
 
 #include "inc/os_tsk.h"
 
+#if OS_TSK_CACHE
+_SLB_DEFINE( TskCache, OS_TSK_CACHE, ABOVE(sizeof(tsk_t)) + ABOVE(OS_STACK_SIZE) );
+#else
+_SLB_EMPTY( TskCache );
+#endif
+
 /* -------------------------------------------------------------------------- */
 void tsk_init( tsk_t *tsk, unsigned prio, fun_t *state, void *stack, unsigned size )
 /* -------------------------------------------------------------------------- */
@@ -67,7 +73,7 @@ tsk_t *wrk_create( unsigned prio, fun_t *state, unsigned size )
 	port_sys_lock();
 
 	size = ABOVE(size);
-	tsk = core_sys_alloc(ABOVE(sizeof(tsk_t)) + size);
+	tsk = core_slb_alloc(TskCache, ABOVE(sizeof(tsk_t)) + size);
 	tsk_init(tsk, prio, state, (void *)ABOVE(tsk + 1), size);
 	tsk->obj.res = tsk;
 
@@ -130,7 +136,7 @@ void tsk_stop( void )
 	if (Current->join != DETACHED)
 		core_tsk_wakeup(Current->join, E_SUCCESS);
 	else
-		core_sys_free(Current->obj.res);
+		core_slb_free(TskCache, Current->obj.res);
 
 	core_tsk_remove(Current);
 
@@ -148,23 +154,23 @@ void tsk_kill( tsk_t *tsk )
 
 	if (tsk->obj.id != ID_STOPPED)
 	{
+		if (tsk->obj.id == ID_DELAYED)
+		{
+			core_tsk_unlink((tsk_t *)tsk, E_STOPPED);
+			core_tmr_remove((tmr_t *)tsk);
+		}
+
 		tsk->mtree = 0;
 		while (tsk->mlist)
 			mtx_kill(tsk->mlist);
 
 		if (tsk->join != DETACHED)
 			core_tsk_wakeup(tsk->join, E_STOPPED);
-		else
-			core_sys_free(tsk->obj.res);
+		else // core_tsk_remove does not return if tsk == Current
+			core_slb_free(TskCache, tsk->obj.res);
 
 		if (tsk->obj.id == ID_READY)
 			core_tsk_remove(tsk);
-		else
-		if (tsk->obj.id == ID_DELAYED)
-		{
-			core_tsk_unlink((tsk_t *)tsk, E_STOPPED);
-			core_tmr_remove((tmr_t *)tsk);
-		}
 	}
 
 	port_sys_unlock();
@@ -226,7 +232,7 @@ unsigned tsk_join( tsk_t *tsk )
 			event = E_SUCCESS;
 
 		if (event != E_TIMEOUT) // !detached
-			core_sys_free(tsk->obj.res);
+			core_slb_free(TskCache, tsk->obj.res);
 	}
 
 	port_sys_unlock();
@@ -303,6 +309,21 @@ unsigned tsk_waitUntil( unsigned flags, uint32_t time )
 	return priv_tsk_wait(flags, time, core_tsk_waitUntil);
 }
 
+/* -------------------------------------------------------------------------- */
+
+#if OS_TIME64
+
+/* -------------------------------------------------------------------------- */
+unsigned tsk_waitUntil64( unsigned flags, uint64_t time )
+/* -------------------------------------------------------------------------- */
+{
+	assert(!port_isr_inside());
+
+	return priv_tsk_wait(flags, core_tsk_until64(time), core_tsk_waitUntil64);
+}
+
+#endif
+
 /* -------------------------------------------------------------------------- */
 unsigned tsk_waitFor( unsigned flags, uint32_t delay )
 /* -------------------------------------------------------------------------- */
@@ -312,6 +333,29 @@ unsigned tsk_waitFor( unsigned flags, uint32_t delay )
 	return priv_tsk_wait(flags, delay, core_tsk_waitFor);
 }
 
+/* -------------------------------------------------------------------------- */
+unsigned tsk_sleepForSlack( uint32_t delay, uint32_t slack )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned event;
+	uint32_t start;
+
+	assert(!port_isr_inside());
+
+	port_sys_lock();
+
+	start = Counter;
+	// align the absolute expiration time, sampling the system counter once
+	if (delay == IMMEDIATE || delay == INFINITE)
+		event = core_tsk_waitFor(&WAIT, delay);
+	else
+		event = core_tsk_waitUntil(&WAIT, start + core_tmr_slack(start, delay, slack));
+
+	port_sys_unlock();
+
+	return event;
+}
+
 /* -------------------------------------------------------------------------- */
 void tsk_give( tsk_t *tsk, unsigned flags )
 /* -------------------------------------------------------------------------- */
@@ -373,3 +417,16 @@ unsigned tsk_resume( tsk_t *tsk )
 }
 
 /* -------------------------------------------------------------------------- */
+
+#if OS_TSK_CACHE
+
+/* -------------------------------------------------------------------------- */
+void tsk_cacheStat( unsigned *hit, unsigned *miss )
+/* -------------------------------------------------------------------------- */
+{
+	core_slb_stat(TskCache, hit, miss);
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
@@ -1425,7 +1425,7 @@ int32 OS_GetErrorName(int32 error_num, os_err_name_t *err_name)
 
 static void timer_handler(void)
 {
-	OS_timer_record_t *rec = (OS_timer_record_t *) WAIT.obj.next;
+	OS_timer_record_t *rec = (OS_timer_record_t *) ThisTmr;
 	uint32 timer_id = (rec - OS_timer_table) / sizeof(OS_timer_record_t);
 
 	rec->handler(timer_id);
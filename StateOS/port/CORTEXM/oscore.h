@@ -161,6 +161,25 @@ void * port_get_sp( void )
 	return (void *) __get_PSP();
 }
 
+/* -------------------------------------------------------------------------- */
+// count leading zeros of a non-zero value
+
+__STATIC_INLINE
+unsigned port_clz( uint32_t value )
+{
+#if (__CORTEX_M >= 3) && !defined(__CSMC__)
+	return __CLZ(value);
+#else
+	unsigned cnt = 0;
+	if (value < 0x00010000U) { cnt += 16; value <<= 16; }
+	if (value < 0x01000000U) { cnt +=  8; value <<=  8; }
+	if (value < 0x10000000U) { cnt +=  4; value <<=  4; }
+	if (value < 0x40000000U) { cnt +=  2; value <<=  2; }
+	if (value < 0x80000000U) { cnt +=  1; }
+	return cnt;
+#endif
+}
+
 /* -------------------------------------------------------------------------- */
 
 #if   defined(__CSMC__)
@@ -190,17 +209,129 @@ void * port_get_sp( void )
 
 #endif
 
+#if OS_LOCK_STATS
+
+#define port_sys_lock()  do { lck_t __LOCK = port_get_lock(); port_set_lock(); if (!__LOCK) core_lck_enter(__func__)
+#define port_sys_unlock()     if (!__LOCK) core_lck_leave(); port_put_lock(__LOCK); } while(0)
+
+#define port_isr_lock()  do { port_set_lock(); core_lck_enter(__func__)
+#define port_isr_unlock()     core_lck_leave(); port_clr_lock(); } while(0)
+
+#else
+
 #define port_sys_lock()  do { lck_t __LOCK = port_get_lock(); port_set_lock()
 #define port_sys_unlock()     port_put_lock(__LOCK); } while(0)
 
 #define port_isr_lock()  do { port_set_lock()
 #define port_isr_unlock()     port_clr_lock(); } while(0)
 
+#endif
+
 #define port_cnt_lock()
 #define port_cnt_unlock()
 
 #define port_set_barrier()  __ISB()
 
+/* -------------------------------------------------------------------------- */
+// briefly open the critical section entered with the 'lck' lock state
+// interrupts with the lowest priority (system handlers) remain masked
+
+__STATIC_INLINE
+void port_sys_flash( lck_t lck )
+{
+#if __CORTEX_M >= 3
+	if (lck == 0)
+	{
+		__set_BASEPRI(((1<<__NVIC_PRIO_BITS)-1)<<(8-__NVIC_PRIO_BITS));
+	#if OS_LOCK_LEVEL
+		port_set_barrier();
+		port_set_lock();
+	#else
+		port_clr_lock();
+		port_set_barrier();
+		port_set_lock();
+		__set_BASEPRI(0);
+	#endif
+	}
+#else
+	(void) lck;
+#endif
+}
+
+/* -------------------------------------------------------------------------- */
+// exclusive access (load-link / store-conditional) for lock-free services
+// the exclusive monitor is cleared on every exception entry and return,
+// so port_ex_store fails if anything was able to change the variable after port_ex_load
+
+#if (__CORTEX_M >= 3) && !defined(__CSMC__)
+
+#define port_ex_supported     1
+
+__STATIC_INLINE
+void * port_ex_load( void **ptr )
+{
+	return (void *) __LDREXW((volatile uint32_t *) ptr);
+}
+
+__STATIC_INLINE
+bool port_ex_store( void **ptr, void *val )
+{
+	return __STREXW((uint32_t) val, (volatile uint32_t *) ptr) == 0U;
+}
+
+__STATIC_INLINE
+void port_ex_clear( void )
+{
+	__CLREX();
+}
+
+__STATIC_INLINE
+void port_ex_add( unsigned *ptr, int val )
+{
+	unsigned cnt;
+	do cnt = __LDREXW((volatile uint32_t *) ptr) + (unsigned) val;
+	while (__STREXW(cnt, (volatile uint32_t *) ptr) != 0U);
+}
+
+#else
+
+#define port_ex_supported     0
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+// enable cpu cycle counter
+
+__STATIC_INLINE
+void port_cyc_init( void )
+{
+#if __CORTEX_M >= 3
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+/* -------------------------------------------------------------------------- */
+// get value of cpu cycle counter (0 if not available)
+
+__STATIC_INLINE
+uint32_t port_cyc_get( void )
+{
+#if __CORTEX_M >= 3
+	return DWT->CYCCNT;
+#else
+	return 0;
+#endif
+}
+
+/* -------------------------------------------------------------------------- */
+// time base of the execution time of tasks (system counter is used if cpu cycle counter is not available)
+
+#if __CORTEX_M >= 3
+#define Runtime port_cyc_get()
+#define RUNTIME_FREQUENCY (CPU_FREQUENCY)
+#endif
+
 /* -------------------------------------------------------------------------- */
 
 __STATIC_INLINE
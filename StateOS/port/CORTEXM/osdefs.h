@@ -48,4 +48,26 @@
 
 /* -------------------------------------------------------------------------- */
 
+#if   defined(__CSMC__)
+
+#ifndef __CALLER
+#define __CALLER()          0
+#endif
+
+#elif defined(__CC_ARM)
+
+#ifndef __CALLER
+#define __CALLER()          __return_address()
+#endif
+
+#else
+
+#ifndef __CALLER
+#define __CALLER()          __builtin_return_address(0)
+#endif
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
 #endif//__STATEOSDEFS_H
@@ -83,12 +83,17 @@ void port_sys_init( void )
 	#endif
 
 	RCC->APB1ENR |= RCC_APB1ENR_TIM2EN;
-	#if OS_ROBIN
+	#if OS_ROBIN || OS_TIME64
 	NVIC_SetPriority(TIM2_IRQn, 0xFF);
 	NVIC_EnableIRQ(TIM2_IRQn);
 	#endif
 	TIM2->PSC  = (CPU_FREQUENCY)/(OS_FREQUENCY)/2-1;
 	TIM2->EGR  = TIM_EGR_UG;
+	#if OS_TIME64
+	TIM2->CCR2 = 1UL << 31;
+	TIM2->SR   = 0;
+	TIM2->DIER = TIM2_DIER_TIME64;
+	#endif
 	TIM2->CR1  = TIM_CR1_CEN;
 
 /******************************************************************************
@@ -136,12 +141,47 @@ void port_sys_init( void )
 /******************************************************************************
  End of configuration
 *******************************************************************************/
+
+#if OS_WAKEUP_STATS || OS_TSK_STATS || OS_LOCK_STATS || OS_TRACE
+
+/******************************************************************************
+ Configuration of cpu cycle counter for statistics
+ Execution time of tasks (OS_TSK_STATS > 1): the core clock is not stopped
+ in sleep mode, so the cycle counter also counts the time the idle task waits
+ for interrupt
+*******************************************************************************/
+
+	port_cyc_init();
+	#if OS_TSK_STATS > 1
+	DBGMCU->CR |= DBGMCU_CR_DBG_SLEEP;
+	#endif
+
+/******************************************************************************
+ End of configuration
+*******************************************************************************/
+
+#endif
 }
 
 /* -------------------------------------------------------------------------- */
 
 #if OS_TICKLESS == 0
 
+/******************************************************************************
+ Non-tick-less mode: number of counts of system timer per tick and the longest
+ possible suppression of ticks
+*******************************************************************************/
+
+	#if (CPU_FREQUENCY)/(OS_FREQUENCY)-1 <= SysTick_LOAD_RELOAD_Msk
+	#define ST_COUNT ((CPU_FREQUENCY)/(OS_FREQUENCY))
+	#else
+	#define ST_COUNT ((ST_FREQUENCY)/(OS_FREQUENCY))
+	#endif
+
+	#define ST_LIMIT ((SysTick_LOAD_RELOAD_Msk+1)/(ST_COUNT)-1)
+
+static  uint32_t Suppressed; // number of suppressed ticks of the current long period
+
 /******************************************************************************
  Non-tick-less mode: interrupt handler of system timer
 *******************************************************************************/
@@ -149,31 +189,117 @@ void port_sys_init( void )
 void SysTick_Handler( void )
 {
 	SysTick->CTRL;
+	if (Suppressed)
+	{
+		core_sys_skip(Suppressed);
+		Suppressed = 0;
+	}
 	core_sys_tick();
 }
 
+/******************************************************************************
+ Non-tick-less mode: suppression of ticks
+ The current period of system timer is extended by 'ticks' periods,
+ the next periods are reloaded with the regular value
+*******************************************************************************/
+
+uint32_t port_tck_suspend( uint32_t ticks )
+{
+	uint32_t ctrl = SysTick->CTRL & ~SysTick_CTRL_COUNTFLAG_Msk;
+
+	if (ticks > ST_LIMIT)
+		ticks = ST_LIMIT;
+
+	if (ticks == 0 || Suppressed)
+		return 0;
+
+	SysTick->CTRL = ctrl & ~SysTick_CTRL_ENABLE_Msk;
+
+	if (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk)
+	{
+		SysTick->CTRL = ctrl;
+		return 0;
+	}
+
+	SysTick->LOAD = SysTick->VAL + ticks * (ST_COUNT);
+	SysTick->VAL  = 0U;
+	SysTick->CTRL = ctrl;
+	SysTick->LOAD = (ST_COUNT)-1;
+
+	Suppressed = ticks;
+
+	return ticks;
+}
+
+/******************************************************************************
+ Non-tick-less mode: restoring of ticks
+ If the long period has not finished, the system timer is restarted with the
+ remaining part of the current tick
+*******************************************************************************/
+
+uint32_t port_tck_resume( void )
+{
+	uint32_t ticks = Suppressed;
+	uint32_t ctrl, val, cnt;
+
+	if (Suppressed == 0)
+		return 0;
+
+	Suppressed = 0;
+
+	ctrl = SysTick->CTRL & ~SysTick_CTRL_COUNTFLAG_Msk;
+	SysTick->CTRL = ctrl & ~SysTick_CTRL_ENABLE_Msk;
+
+	if (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk)
+	{
+		SysTick->CTRL = ctrl; // the last tick is counted by the pending interrupt
+		return ticks;
+	}
+
+	val = SysTick->VAL;
+	cnt = (val + (ST_COUNT)-1) / (ST_COUNT); // number of ticks not elapsed
+	val = val - (cnt - 1) * (ST_COUNT);      // remaining part of the current tick
+
+	SysTick->LOAD = val > 1 ? val - 1 : 1;
+	SysTick->VAL  = 0U;
+	SysTick->CTRL = ctrl;
+	SysTick->LOAD = (ST_COUNT)-1;
+
+	return ticks + 1 - cnt;
+}
+
 /******************************************************************************
  End of the handler
 *******************************************************************************/
 
 #else //OS_TICKLESS
 
-	#if OS_ROBIN
+	#if OS_ROBIN || OS_TIME64
 
 /******************************************************************************
- Non-tick-less mode with preemption: interrupt handler of system timer
+ Non-tick-less mode with preemption or 64-bit system time: interrupt handler of system timer
+ Update and compare 2 events mark both halves of the system counter period
 *******************************************************************************/
 
 void TIM2_IRQHandler( void )
 {
 	TIM2->SR = 0;
+	#if OS_TIME64
+	core_sys_wrap();
+	#endif
+	#if OS_ROBIN
 	core_tmr_handler();
+	#endif
 }
 
 /******************************************************************************
  End of the handler
 *******************************************************************************/
 
+	#endif
+
+	#if OS_ROBIN
+
 /******************************************************************************
  Non-tick-less mode with preemption: interrupt handler for context switch triggering
 *******************************************************************************/
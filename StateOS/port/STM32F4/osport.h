@@ -84,6 +84,15 @@ extern "C" {
 #error  osconfig.h: Incorrect OS_ROBIN value!
 #endif
 
+/* -------------------------------------------------------------------------- */
+// timer interrupts marking both halves of the system counter period (tick-less mode)
+
+#if     OS_TIME64
+#define TIM2_DIER_TIME64   (TIM_DIER_UIE|TIM_DIER_CC2IE)
+#else
+#define TIM2_DIER_TIME64    0
+#endif
+
 /* -------------------------------------------------------------------------- */
 // force yield system control to the next process
 
@@ -111,7 +120,7 @@ __STATIC_INLINE
 void port_tmr_stop( void )
 {
 #if OS_ROBIN && OS_TICKLESS
-	TIM2->DIER = 0;
+	TIM2->DIER = TIM2_DIER_TIME64;
 #endif
 }
 	
@@ -123,7 +132,7 @@ void port_tmr_start( uint32_t timeout )
 {
 #if OS_ROBIN && OS_TICKLESS
 	TIM2->CCR1 = timeout;
-	TIM2->DIER = TIM_DIER_CC1IE;
+	TIM2->DIER = TIM2_DIER_TIME64|TIM_DIER_CC1IE;
 #else
 	(void) timeout;
 #endif
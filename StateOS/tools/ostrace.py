@@ -0,0 +1,129 @@
+#!/usr/bin/env python3
+"""
+    @file    StateOS: ostrace.py
+    @author  Rajmund Szymanski
+    @brief   Decoder of the StateOS kernel event trace (OS_TRACE).
+
+    StateOS - Copyright (C) 2013 Rajmund Szymanski.
+
+    This file is part of StateOS distribution.
+
+    StateOS is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published
+    by the Free Software Foundation; either version 3 of the License,
+    or (at your option) any later version.
+
+    StateOS is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+    usage: ostrace.py [-c] [-n names] dump
+      dump : binary dump of the trace buffer (sys_traceBuffer) or of the whole ram containing it
+      -c   : print Chrome trace JSON (chrome://tracing, ui.perfetto.dev) instead of the timeline
+      -n   : file with lines 'address name' naming tasks and objects (e.g. taken from the map file)
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+TRC_MAGIC = 0x43525453
+
+TYPES = { 1: 'switch', 2: 'wakeup', 3: 'wait', 4: 'timer', 5: 'give', 6: 'take' }
+
+EVENTS = { 0x000000: 'E_SUCCESS', 0xFFFFFF: 'E_STOPPED', 0xFFFFFE: 'E_TIMEOUT' }
+
+
+def find(dump):
+    for pos in range(0, len(dump) - 16, 4):
+        if struct.unpack_from('<I', dump, pos)[0] == TRC_MAGIC:
+            freq, limit, head = struct.unpack_from('<III', dump, pos + 4)
+            if limit and (limit & (limit - 1)) == 0 and pos + 16 + limit * 12 <= len(dump):
+                return pos, freq, limit, head
+    sys.exit('ostrace: trace buffer not found')
+
+
+def records(dump):
+    pos, freq, limit, head = find(dump)
+    count = min(head, limit)
+    first = head - count
+    time = 0
+    last = None
+    for n in range(first, head):
+        stamp, info, obj = struct.unpack_from('<III', dump, pos + 16 + (n % limit) * 12)
+        if last is not None:
+            time += (stamp - last) & 0xFFFFFFFF
+        last = stamp
+        yield time / freq * 1e6, info & 0xFF, info >> 8, obj
+
+
+def names(path):
+    result = {}
+    if path:
+        with open(path) as f:
+            for line in f:
+                parts = line.split()
+                if len(parts) >= 2:
+                    result[int(parts[0], 16)] = parts[1]
+    return result
+
+
+def label(obj, known):
+    return known.get(obj, '0x%08X' % obj)
+
+
+def detail(typ, data):
+    if typ == 1:
+        return 'prio=%d' % data
+    if typ == 3:
+        return 'delay=%s' % ('INFINITE' if data == 0xFFFFFF else data)
+    if typ in (2, 5, 6):
+        return EVENTS.get(data, 'event=0x%06X' % data)
+    return ''
+
+
+def timeline(recs, known):
+    for us, typ, data, obj in recs:
+        print('%14.3f us  %-6s  %-20s %s' % (us, TYPES.get(typ, '?%d' % typ), label(obj, known), detail(typ, data)))
+
+
+def chrome(recs, known):
+    out = []
+    task = None
+    for us, typ, data, obj in recs:
+        if typ == 1:
+            if task is not None:
+                out.append({ 'name': label(task, known), 'ph': 'E', 'ts': us, 'pid': 0, 'tid': 0 })
+            task = obj
+            out.append({ 'name': label(obj, known), 'ph': 'B', 'ts': us, 'pid': 0, 'tid': 0, 'args': { 'prio': data } })
+        else:
+            out.append({ 'name': '%s %s' % (TYPES.get(typ, '?'), label(obj, known)), 'ph': 'i', 's': 't',
+                         'ts': us, 'pid': 0, 'tid': 0, 'args': { 'data': detail(typ, data) } })
+    if task is not None and out:
+        out.append({ 'name': label(task, known), 'ph': 'E', 'ts': out[-1]['ts'], 'pid': 0, 'tid': 0 })
+    json.dump({ 'traceEvents': out, 'displayTimeUnit': 'ns' }, sys.stdout, indent=1)
+    print()
+
+
+def main():
+    parser = argparse.ArgumentParser(description='StateOS kernel event trace decoder')
+    parser.add_argument('dump')
+    parser.add_argument('-c', '--chrome', action='store_true')
+    parser.add_argument('-n', '--names')
+    args = parser.parse_args()
+    with open(args.dump, 'rb') as f:
+        dump = f.read()
+    recs = list(records(dump))
+    if args.chrome:
+        chrome(recs, names(args.names))
+    else:
+        timeline(recs, names(args.names))
+
+
+if __name__ == '__main__':
+    main()
@@ -44,6 +44,22 @@
 // default value: 0
 #define  OS_TICKLESS          0
 
+// ----------------------------
+// suppression of system timer ticks in the idle task (used only if OS_TICKLESS == 0)
+// OS_IDLE_TICKLESS == 0 => the system timer generates interrupts with frequency OS_FREQUENCY all the time
+// OS_IDLE_TICKLESS != 0 => the idle task delays the next interrupt of the system timer until the nearest expiration of timers and delayed tasks
+//                          (as far as the system timer allows) and corrects the system counter after wakeup
+// default value: 0
+#define  OS_IDLE_TICKLESS     0
+
+// ----------------------------
+// 64-bit system time (sys_time64, xxx_waitUntil64, tmr_startUntil64, tsk_sleepUntil64)
+// OS_TIME64 == 0 => only 32-bit system counter is available
+// OS_TIME64 != 0 => the system counter is extended with the number of its half periods, updated by the system timer handler
+//                   (tick-less mode: update and compare interrupts of the system timer); the 64-bit system time is read lock-free
+// default value: 0
+#define  OS_TIME64            0
+
 // ----------------------------
 // system mode, round-robin frequency in Hz
 // OS_ROBIN == 0 => os works in cooperative mode
@@ -63,13 +79,177 @@
 // default value: 0 (the same as priority of idle process)
 #define  OS_MAIN_PRIO         0
 
+// ----------------------------
+// number of task priority levels indexed in the tasks ready queue
+// OS_PRIO_MAP == 0 => ready queue is searched linearly
+// OS_PRIO_MAP >  0 => ready queue is indexed by priority bitmap, tasks with priority greater or equal OS_PRIO_MAP share one level (searched linearly)
+// default value: 0
+#define  OS_PRIO_MAP          0
+
+// ----------------------------
+// number of slots per level of the hierarchical timing wheel
+// OS_TMR_WHEEL == 0 => timers queue is a sorted list (linear search)
+// OS_TMR_WHEEL >  0 => timers queue is a hierarchical timing wheel, OS_TMR_WHEEL must be a power of 2 not greater than 32
+// default value: 0
+#define  OS_TMR_WHEEL         0
+
+// ----------------------------
+// using pairing heap for the timers queue (recommended for tick-less mode)
+// OS_TMR_HEAP == 0 => timers queue is a sorted list (linear search) or a timing wheel (OS_TMR_WHEEL)
+// OS_TMR_HEAP != 0 => timers queue is a pairing heap, cannot be used together with OS_TMR_WHEEL
+// default value: 0
+#define  OS_TMR_HEAP          0
+
+// ----------------------------
+// number of tasks resumed at once by a broadcast wakeup (kill, give of events, signals, barriers, timers, etc.)
+// OS_WAKEUP_CHUNK == 0 => all waiting tasks are resumed in one critical section
+// OS_WAKEUP_CHUNK >  0 => pending interrupts are served after each OS_WAKEUP_CHUNK resumed tasks
+// default value: 0
+#define  OS_WAKEUP_CHUNK      0
+
+// ----------------------------
+// number of call sites of a broadcast wakeup recorded in masked time statistics (sys_wakeupStat)
+// OS_WAKEUP_STATS == 0 => masked time statistics are not collected
+// OS_WAKEUP_STATS >  0 => the longest masked interval (in cpu cycles) is recorded for each call site
+// default value: 0
+#define  OS_WAKEUP_STATS      0
+
+// ----------------------------
+// skipping of groups of tasks with the same priority when searching the objects DELAYED queues
+// (the queues remain sorted lists, this is not a priority-indexed queue)
+// OS_WAIT_SKIP == 0 => linear search of the objects DELAYED queue
+// OS_WAIT_SKIP != 0 => tasks with the same priority are grouped, only the first tasks of the groups are searched
+//                      appending a task takes one step per distinct priority of waiting tasks (not constant time),
+//                      removing a task is done in constant time
+// default value: 0
+#define  OS_WAIT_SKIP         0
+
+// ----------------------------
+// direct handoff to the task resumed by message queues, mailbox queues and semaphores
+// OS_HANDOFF == 0 => the resumed task is inserted into the tasks READY queue, the next task is chosen by the PendSV handler
+// OS_HANDOFF != 0 => if the resumed task outranks all tasks in the READY queue, the PendSV handler switches to it directly
+// default value: 1
+#define  OS_HANDOFF           1
+
+// ----------------------------
+// size of the deferred queue of tasks resumed in handler mode (isr)
+// OS_ISR_QUEUE == 0 => tasks resumed in handler mode are moved to the tasks READY queue immediately
+// OS_ISR_QUEUE >  0 => tasks resumed in handler mode are posted to the deferred queue and moved to the tasks READY queue by the PendSV handler
+//                      OS_ISR_QUEUE must be a power of 2, the task is resumed immediately when the deferred queue is full
+//                      only the resumption of the task is deferred: the object operation (counter update, data copy)
+//                      and removal of the task from the object queue are still performed in the handler,
+//                      so the results of 'xxx_giveISR' functions are exact
+// default value: 0
+#define  OS_ISR_QUEUE         0
+
+// ----------------------------
+// size of the queue of timer callback procedures posted to the timer service task
+// OS_TMR_TASK == 0 => timer callback procedures are executed in handler mode (inside the timers queue handler)
+// OS_TMR_TASK >  0 => timer callback procedures are posted to the timer service task and executed in thread mode outside the critical section
+//                     OS_TMR_TASK must be a power of 2, the callback procedure is executed in handler mode when the queue is full
+//                     or when the timer was selected with 'tmr_setHandlerMode'
+//                     tasks waiting for the timer are resumed by the timer service task after the posted callback procedure
+// default value: 0
+#define  OS_TMR_TASK          0
+
+// ----------------------------
+// counting of expirations of timers and delayed tasks (sys_tmrStat)
+// OS_TMR_STATS == 0 => expirations are not counted
+// OS_TMR_STATS != 0 => the timers queue handler counts expirations and its passes with any expiration,
+//                      the difference is the number of timer interrupts saved by timers started with a slack
+// default value: 0
+#define  OS_TMR_STATS         0
+
+// ----------------------------
+// execution time accounting of tasks (tsk_getStats, sys_cpuStat)
+// OS_TSK_STATS == 0 => execution time of tasks is not counted
+// OS_TSK_STATS == 1 => the context switch handler charges the time elapsed since the previous switch to the current task
+//                      and counts switches to each task; time is counted in cpu cycles (Cortex-M3 and above) or in system
+//                      timer ticks; the time is also charged on each tick of the system timer; in the tick-less cooperative
+//                      mode a task must not run longer than 2^32 cpu cycles without a context switch
+//                      cpu cycles are not counted in sleep mode, the idle task time does not include waiting for interrupt,
+//                      so the cpu load cannot be computed and 'sys_cpuStat' is not available
+// OS_TSK_STATS >  1 => as above, but the core clock is kept running in sleep mode (debug sleep mode), so the idle task time
+//                      is the time the cpu is not loaded and 'sys_cpuStat' is available;
+//                      this cancels the power saving of the sleep mode
+// default value: 0
+#define  OS_TSK_STATS         0
+
+// ----------------------------
+// number of records in the ring buffer of the kernel event trace (sys_traceBuffer)
+// OS_TRACE == 0 => kernel events are not recorded
+// OS_TRACE >  0 => context switches, resumed and blocked tasks, expired timers and give / take of semaphores, mutexes,
+//                  message and mailbox queues are recorded with a time stamp (12 bytes per record), the oldest records
+//                  are overwritten; OS_TRACE must be a power of 2; the dump is decoded by the host tool: tools/ostrace.py
+// default value: 0
+#define  OS_TRACE             0
+
+// ----------------------------
+// number of call sites of the critical section profiler (sys_lockStat)
+// OS_LOCK_STATS == 0 => kernel critical sections are not profiled
+// OS_LOCK_STATS >  0 => hold time of each outermost kernel critical section is measured (in cpu cycles) and recorded
+//                       for the function that entered it: the number of sections, the longest hold time and
+//                       the histogram of hold times (sections are split where the kernel switches context)
+// default value: 0
+#define  OS_LOCK_STATS        0
+
+// ----------------------------
+// priority of the timer service task (used if OS_TMR_TASK > 0)
+// default value: ~0U (the highest priority)
+#define  OS_TMR_PRIO       (~0U)
+
+// ----------------------------
+// stack size of the timer service task in bytes (used if OS_TMR_TASK > 0)
+// default value: OS_STACK_SIZE
+#define  OS_TMR_STACK      OS_STACK_SIZE
+
 // ----------------------------
 // os heap size in bytes
 // OS_HEAP_SIZE == 0 => functions 'xxx_create' use 'malloc' provided with the compiler libraries
 // OS_HEAP_SIZE >  0 => functions 'xxx_create' allocate memory on a dedicated system heap, OS_HEAP_SIZE indicates size of the heap
+//                      the heap is managed by the two-level segregated fit (TLSF) allocator: allocation and freeing in constant time,
+//                      requests are rounded up to the next size class (good fit), adjacent free blocks are merged,
+//                      statistics available with 'sys_heapStat'
 // default value: 0
 #define  OS_HEAP_SIZE         0
 
+// ----------------------------
+// size of message queues, mailbox queues and job queues
+// OS_QUEUE_POW2 == 0 => queues of any size, indices of the queue buffer are wrapped by comparison with the size of the queue
+// OS_QUEUE_POW2 != 0 => size of every queue must be a power of 2, free-running indices of the queue buffer are masked,
+//                       checked with assertions and at compile time in c++ templates (MessageQueueT, MailBoxQueueT, JobQueueT)
+// default value: 0
+#define  OS_QUEUE_POW2        0
+
+// ----------------------------
+// lock-free services of memory pools
+// OS_MEM_LOCKFREE == 0 => memory pools are protected by critical sections (interrupts are masked)
+// OS_MEM_LOCKFREE != 0 => memory objects are taken from and given to the memory pool with exclusive access (LDREX / STREX),
+//                         interrupts are masked only when tasks are waiting for the memory pool or the memory pool is empty
+//                         not available on Cortex-M0 (option is ignored)
+// default value: 0
+#define  OS_MEM_LOCKFREE      0
+
+// ----------------------------
+// capacity of the caches of objects created with 'xxx_create' functions (number of objects of given type)
+// OS_XXX_CACHE == 0 => objects are allocated on the system heap
+// OS_XXX_CACHE >  0 => objects are allocated from a statically preallocated cache and returned to the cache by 'xxx_delete'
+//                      when the cache is exhausted, objects are allocated on the system heap
+//                      task cache (OS_TSK_CACHE) holds tasks with stack size not greater than OS_STACK_SIZE
+//                      hit / miss counters of the cache are available with 'xxx_cacheStat'
+// default value: 0
+#define  OS_BAR_CACHE         0
+#define  OS_CND_CACHE         0
+#define  OS_EVT_CACHE         0
+#define  OS_FLG_CACHE         0
+#define  OS_LST_CACHE         0
+#define  OS_MTX_CACHE         0
+#define  OS_MUT_CACHE         0
+#define  OS_SEM_CACHE         0
+#define  OS_SIG_CACHE         0
+#define  OS_TMR_CACHE         0
+#define  OS_TSK_CACHE         0
+
 // ----------------------------
 // default task stack size in bytes
 // default value: 256